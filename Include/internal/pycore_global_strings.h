@@ -620,6 +620,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(overlapped)
         STRUCT_FOR_ID(owner)
         STRUCT_FOR_ID(pages)
+        STRUCT_FOR_ID(parallel)
         STRUCT_FOR_ID(parent)
         STRUCT_FOR_ID(password)
         STRUCT_FOR_ID(path)
@@ -1129,6 +1129,7 @@ extern "C" {
     INIT_ID(overlapped), \
     INIT_ID(owner), \
     INIT_ID(pages), \
+    INIT_ID(parallel), \
     INIT_ID(parent), \
     INIT_ID(password), \
     INIT_ID(path), \
@@ -825,7 +825,8 @@ def call_soon(self, callback, *args, context=None):
         Any positional arguments after the callback will be passed to
         the callback when it is called.
         """
-        self._check_closed()
+        if self._closed:
+            self._check_closed()
         if self._debug:
             self._check_thread()
             self._check_callback(callback, 'call_soon')
@@ -1998,14 +1999,15 @@ def _run_once(self):
         event_list = None
 
         # Handle 'later' callbacks that are ready.
-        end_time = self.time() + self._clock_resolution
-        while self._scheduled:
-            handle = self._scheduled[0]
-            if handle._when >= end_time:
-                break
-            handle = heapq.heappop(self._scheduled)
-            handle._scheduled = False
-            self._ready.append(handle)
+        if self._scheduled:
+            end_time = self.time() + self._clock_resolution
+            while self._scheduled:
+                handle = self._scheduled[0]
+                if handle._when >= end_time:
+                    break
+                handle = heapq.heappop(self._scheduled)
+                handle._scheduled = False
+                self._ready.append(handle)
 
         # This is the only place where callbacks are actually *called*.
         # All other places just add them to ready.
@@ -2014,8 +2016,9 @@ def _run_once(self):
         # they will be run the next time (after another I/O poll).
         # Use an idiom that is thread-safe without using locks.
         ntodo = len(self._ready)
+        popleft = self._ready.popleft
         for i in range(ntodo):
-            handle = self._ready.popleft()
+            handle = popleft()
             if handle._cancelled:
                 continue
             if self._debug:
@@ -13,6 +13,7 @@
 import os
 import selectors
 import socket
+import threading
 import warnings
 import weakref
 try:
@@ -39,6 +40,23 @@
         # Fallback to send
         _HAS_SENDMSG = False
 
+class _RecvBuffer(threading.local):
+    view = None
+
+_recv_buffer = _RecvBuffer()
+
+
+def _get_recv_buffer(size):
+    # Transports receive into this per-thread scratch buffer and copy the
+    # data out, rather than asking recv() for a new max_size bytes object:
+    # an allocation that large is usually served by mmap() and then shrunk
+    # with mremap(), adding system calls and page faults to every read.
+    view = _recv_buffer.view
+    if view is None or len(view) < size:
+        view = _recv_buffer.view = memoryview(bytearray(size))
+    return view
+
+
 def _test_selector_event(selector, fd, event):
     # Test if the selector is monitoring 'event' events
     # for the file descriptor 'fd'.
@@ -1002,7 +1020,8 @@ def _read_ready__data_received(self):
         if self._conn_lost:
             return
         try:
-            data = self._sock.recv(self.max_size)
+            buf = _get_recv_buffer(self.max_size)
+            nbytes = self._sock.recv_into(buf, self.max_size)
         except (BlockingIOError, InterruptedError):
             return
         except (SystemExit, KeyboardInterrupt):
@@ -1011,10 +1030,11 @@ def _read_ready__data_received(self):
             self._fatal_error(exc, 'Fatal read error on socket transport')
             return
 
-        if not data:
+        if not nbytes:
             self._read_ready__on_eof()
             return
 
+        data = buf[:nbytes].tobytes()
         try:
             self._protocol.data_received(data)
         except (SystemExit, KeyboardInterrupt):
@@ -1227,7 +1247,8 @@ def _read_ready(self):
         if self._conn_lost:
             return
         try:
-            data, addr = self._sock.recvfrom(self.max_size)
+            buf = _get_recv_buffer(self.max_size)
+            nbytes, addr = self._sock.recvfrom_into(buf, self.max_size)
         except (BlockingIOError, InterruptedError):
             pass
         except OSError as exc:
@@ -1237,7 +1258,7 @@ def _read_ready(self):
         except BaseException as exc:
             self._fatal_error(exc, 'Fatal read error on datagram transport')
         else:
-            self._protocol.datagram_received(data, addr)
+            self._protocol.datagram_received(buf[:nbytes].tobytes(), addr)
 
     def sendto(self, data, addr=None):
         if not isinstance(data, (bytes, bytearray, memoryview)):
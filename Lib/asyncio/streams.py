@@ -428,6 +428,7 @@ def __init__(self, limit=_DEFAULT_LIMIT, loop=None):
         self._buffer = bytearray()
         self._eof = False    # Whether we're done.
         self._waiter = None  # A future used by _wait_for_data()
+        self._wait_size = 0  # Buffer size that the waiter is waiting for.
         self._exception = None
         self._transport = None
         self._paused = False
@@ -497,7 +498,6 @@ def feed_data(self, data):
             return
 
         self._buffer.extend(data)
-        self._wakeup_waiter()
 
         if (self._transport is not None and
                 not self._paused and
@@ -512,9 +512,17 @@ def feed_data(self, data):
             else:
                 self._paused = True
 
-    async def _wait_for_data(self, func_name):
+        # Don't wake up readexactly() for every chunk while it still lacks
+        # data, unless reading is paused: the reader has to resume it.
+        if len(self._buffer) >= self._wait_size or self._paused:
+            self._wakeup_waiter()
+
+    async def _wait_for_data(self, func_name, size=0):
         """Wait until feed_data() or feed_eof() is called.
 
+        If *size* is given, feed_data() only wakes up the waiter once the
+        buffer holds at least *size* bytes.
+
         If stream was paused, automatically resume it.
         """
         # StreamReader uses a future to link the protocol feed_data() method
@@ -535,10 +543,12 @@ async def _wait_for_data(self, func_name):
             self._transport.resume_reading()
 
         self._waiter = self._loop.create_future()
+        self._wait_size = size
         try:
             await self._waiter
         finally:
             self._waiter = None
+            self._wait_size = 0
 
     async def readline(self):
         """Read chunk of data from the stream until newline (b'\n') is found.
@@ -558,6 +568,15 @@ async def readline(self):
         """
         sep = b'\n'
         seplen = len(sep)
+        if self._exception is None:
+            # Fast path: a complete line is already buffered.
+            isep = self._buffer.find(sep, 0, self._limit + seplen)
+            if isep != -1:
+                end = isep + seplen
+                line = self._buffer[:end]
+                del self._buffer[:end]
+                self._maybe_resume_transport()
+                return bytes(line)
         try:
             line = await self.readuntil(sep)
         except exceptions.IncompleteReadError as e:
@@ -766,7 +785,7 @@ async def readexactly(self, n):
                 self._buffer.clear()
                 raise exceptions.IncompleteReadError(incomplete, n)
 
-            await self._wait_for_data('readexactly')
+            await self._wait_for_data('readexactly', n)
 
         if len(self._buffer) == n:
             data = bytes(self._buffer)
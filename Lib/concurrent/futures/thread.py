@@ -196,6 +196,9 @@ def __init__(self, max_workers=None, thread_name_prefix='',
                                     ("ThreadPoolExecutor-%d" % self._counter()))
 
     def submit(self, fn, /, *args, **kwargs):
+        # The locks serialize all concurrent submit() calls, so create
+        # the future before taking them.
+        f = _base.Future()
         with self._shutdown_lock, _global_shutdown_lock:
             if self._broken:
                 raise self.BROKEN(self._broken)
@@ -206,7 +209,6 @@ def submit(self, fn, /, *args, **kwargs):
                 raise RuntimeError('cannot schedule new futures after '
                                    'interpreter shutdown')
 
-            f = _base.Future()
             task = self._resolve_work_item_task(fn, args, kwargs)
             w = _WorkItem(f, task)
 
@@ -1,5 +1,6 @@
 """Implementation of JSONDecoder
 """
+import codecs
 import re
 
 from json import scanner
@@ -362,3 +363,64 @@ def raw_decode(self, s, idx=0):
         except StopIteration as err:
             raise JSONDecodeError("Expecting value", s, err.value) from None
         return obj, end
+
+    def iterdecode(self, chunks):
+        """Decode a stream of JSON documents separated by optional
+        whitespace, such as newline-delimited JSON, and yield their Python
+        representations.
+
+        ``chunks`` is an iterable of ``str`` or UTF-8 encoded ``bytes``
+        pieces of the stream, split at arbitrary points.  Only the text of
+        the document being decoded is kept in memory.
+
+        """
+        decoder = None
+        pending = []
+        pending_len = 0
+        retry_len = 0
+        for chunk in chunks:
+            if not isinstance(chunk, str):
+                if decoder is None:
+                    decoder = codecs.getincrementaldecoder('utf-8')()
+                chunk = decoder.decode(chunk)
+            pending.append(chunk)
+            pending_len += len(chunk)
+            # A document cut short is decoded again from its start, so
+            # only retry once the text has doubled, or at a line end as
+            # long as that costs a bounded amount per character read.
+            if pending_len < retry_len and (
+                    '\n' not in chunk or pending_len > 16 * len(chunk)):
+                continue
+            s = ''.join(pending)
+            idx = yield from self._iterdecode(s, False)
+            if idx < len(s):
+                pending = [s[idx:]]
+            else:
+                pending = []
+            pending_len = retry_len = len(s) - idx
+            retry_len *= 2
+        if decoder is not None:
+            pending.append(decoder.decode(b'', True))
+        yield from self._iterdecode(''.join(pending), True)
+
+    def _iterdecode(self, s, final, _w=WHITESPACE.match):
+        # Yield the documents in s and return the index of the rest.
+        idx = 0
+        while True:
+            idx = _w(s, idx).end()
+            if idx == len(s):
+                return idx
+            try:
+                obj, end = self.raw_decode(s, idx)
+            except JSONDecodeError as err:
+                # A document cut short fails in its last token, which
+                # cannot span lines in strict mode.
+                if final or (self.strict and s.find('\n', err.pos) >= 0):
+                    raise
+                return idx
+            if (not final and '0' <= s[end - 1] <= '9'
+                    and s[end:end + 1] in ('', '.', 'e', 'E')):
+                # The number may continue in the next chunk.
+                return idx
+            yield obj
+            idx = end
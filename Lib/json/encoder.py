@@ -33,6 +33,9 @@
 del i
 
 INFINITY = float('inf')
+# Containers with more items than this, counting those of nested containers,
+# are split into several chunks by JSONEncoder.iterencode().
+_C_CHUNK_ITEMS = 1000
 
 def py_encode_basestring(s):
     """Return a JSON representation of a Python string
@@ -248,20 +251,25 @@ def floatstr(o, allow_nan=self.allow_nan,
             indent = self.indent
         else:
             indent = ' ' * self.indent
-        if _one_shot and c_make_encoder is not None:
-            _iterencode = c_make_encoder(
+        if c_make_encoder is not None:
+            c_iterencode = c_make_encoder(
                 markers, self.default, _encoder, indent,
                 self.key_separator, self.item_separator, self.sort_keys,
                 self.skipkeys, self.allow_nan)
+        else:
+            c_iterencode = None
+        if _one_shot and c_iterencode is not None:
+            _iterencode = c_iterencode
         else:
             _iterencode = _make_iterencode(
                 markers, self.default, _encoder, indent, floatstr,
                 self.key_separator, self.item_separator, self.sort_keys,
-                self.skipkeys, _one_shot)
+                self.skipkeys, _one_shot, c_iterencode)
         return _iterencode(o, 0)
 
 def _make_iterencode(markers, _default, _encoder, _indent, _floatstr,
         _key_separator, _item_separator, _sort_keys, _skipkeys, _one_shot,
+        _c_iterencode=None,
         ## HACK: hand-optimized bytecode; turn globals into locals
         ValueError=ValueError,
         dict=dict,
@@ -269,12 +277,42 @@ def _make_iterencode(markers, _default, _encoder, _indent, _floatstr,
         id=id,
         int=int,
         isinstance=isinstance,
+        len=len,
         list=list,
         str=str,
         tuple=tuple,
+        type=type,
         _intstr=int.__repr__,
+        _scalar_types=frozenset({str, int, float, bool, type(None)}),
     ):
 
+    def _is_small(o):
+        # Containers holding at most _C_CHUNK_ITEMS items in total, nested
+        # containers included, are encoded as a single chunk by the C
+        # encoder, if available.  Anything else is iterated over, so that
+        # the size of the chunks stays bounded.  Objects that need
+        # _default() may turn into anything, so they are never small.
+        if _c_iterencode is None or not isinstance(o, (list, tuple, dict)):
+            return False
+        budget = _C_CHUNK_ITEMS - len(o)
+        if budget < 0:
+            return False
+        stack = []
+        while True:
+            for value in (o.values() if isinstance(o, dict) else o):
+                if type(value) in _scalar_types:
+                    continue
+                if isinstance(value, (list, tuple, dict)):
+                    budget -= len(value)
+                    if budget < 0:
+                        return False
+                    stack.append(value)
+                elif not isinstance(value, (str, int, float)):
+                    return False
+            if not stack:
+                return True
+            o = stack.pop()
+
     def _iterencode_list(lst, _current_indent_level):
         if not lst:
             yield '[]'
@@ -313,6 +351,8 @@ def _iterencode_list(lst, _current_indent_level):
                 elif isinstance(value, float):
                     # see comment above for int
                     yield buf + _floatstr(value)
+                elif _is_small(value):
+                    yield buf + _c_iterencode(value, _current_indent_level)[0]
                 else:
                     yield buf
                     if isinstance(value, (list, tuple)):
@@ -400,6 +440,8 @@ def _iterencode_dict(dct, _current_indent_level):
                 elif isinstance(value, float):
                     # see comment for int/float in _make_iterencode
                     yield _floatstr(value)
+                elif _is_small(value):
+                    yield _c_iterencode(value, _current_indent_level)[0]
                 else:
                     if isinstance(value, (list, tuple)):
                         chunks = _iterencode_list(value, _current_indent_level)
@@ -496,9 +496,15 @@ def dump(self, obj):
             self.write(PROTO + pack("<B", self.proto))
         if self.proto >= 4:
             self.framer.start_framing()
-        self.save(obj)
-        self.write(STOP)
-        self.framer.end_framing()
+        try:
+            self.save(obj)
+            self.write(STOP)
+            self.framer.end_framing()
+        finally:
+            if self.fast:
+                # Only globals are memoized in fast mode, and a fast pickle
+                # must not refer to them from the previous dump().
+                self.memo.clear()
 
     def memoize(self, obj):
         """Store an object in the memo."""
@@ -517,6 +523,9 @@ def memoize(self, obj):
         # growable) array, indexed by memo key.
         if self.fast:
             return
+        self._memoize(obj)
+
+    def _memoize(self, obj):
         assert id(obj) not in self.memo
         idx = len(self.memo)
         self.write(self.put(idx))
@@ -1221,7 +1230,9 @@ def save_global(self, obj, name=None):
         else:
             self._save_toplevel_by_name(module_name, name)
 
-        self.memoize(obj)
+        # Globals are memoized even in fast mode: they cannot be part of a
+        # cycle, and all instances of a class refer to the same one.
+        self._memoize(obj)
 
     def _save_toplevel_by_name(self, module_name, name):
         if self.proto >= 3:
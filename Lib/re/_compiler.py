@@ -175,7 +175,10 @@ def _compile(code, pattern, flags):
             emit(op)
             tail = []
             tailappend = tail.append
-            for av in av[1]:
+            items = av[1]
+            if not (flags & SRE_FLAG_IGNORECASE and flags & SRE_FLAG_LOCALE):
+                items = _merge_branches(items, iscased)
+            for av in items:
                 skip = _len(code); emit(0)
                 # _compile_info(code, av, flags)
                 _compile(code, av, flags)
@@ -413,6 +416,52 @@ def _simple(p):
         return av[0] is None and _simple(av[-1])
     return op in _UNIT_CODES
 
+def _merge_branches(items, iscased):
+    # Alternatives which start with different literals cannot match at
+    # the same position, so they can be regrouped by their first literal
+    # without changing which alternative matches first.  Turn a|b|c into
+    # a trie so that a long alternation of words does not try every word
+    # at every position.  An alternative which does not start with a
+    # literal keeps its place relative to all other alternatives.
+    groups = {}
+    result = []
+    merged = False
+    for item in items:
+        if item:
+            op, av = item[0]
+            if op is LITERAL and not (iscased and iscased(av)):
+                if av in groups:
+                    groups[av].append(item)
+                    merged = True
+                else:
+                    groups[av] = group = [item]
+                    result.append(group)
+                continue
+        groups = {}
+        result.append([item])
+    if not merged:
+        return items
+    items = []
+    for group in result:
+        item = group[0]
+        if len(group) == 1:
+            items.append(item)
+            continue
+        # move the common literal prefix out of the group
+        n = 1
+        while all(len(p) > n and p[n] == item[n] and p[n][0] is LITERAL
+                  for p in group):
+            n += 1
+        rests = [p[n:] for p in group]
+        if all(len(p) == 1 and p[0][0] is LITERAL for p in rests):
+            tail = (IN, _parser._uniq([p[0] for p in rests]))
+        else:
+            tail = (BRANCH, (None, rests))
+        item = item[:n]
+        item.append(tail)
+        items.append(item)
+    return items
+
 def _generate_overlap_table(prefix):
     """
     Generate an overlap table for the following prefix.
@@ -442,6 +491,12 @@ def _get_iscased(flags):
     else:
         return _sre.ascii_iscased
 
+def _is_prefix_assertion(av, flags):
+    # zero-width assertions which can be checked after a literal prefix
+    # has been found, rather than at every position
+    return (av is AT_BOUNDARY or av is AT_NON_BOUNDARY or
+            (av is AT_BEGINNING and flags & SRE_FLAG_MULTILINE))
+
 def _get_literal_prefix(pattern, flags):
     # look for literal prefix
     prefix = []
@@ -453,6 +508,10 @@ def _get_literal_prefix(pattern, flags):
             if iscased and iscased(av):
                 break
             prefixappend(av)
+        elif op is AT and _is_prefix_assertion(av, flags):
+            # the match must start at the assertion
+            if prefix_skip is None:
+                prefix_skip = len(prefix)
         elif op is SUBPATTERN:
             group, add_flags, del_flags, p = av
             flags1 = _combine_flags(flags, add_flags, del_flags)
@@ -478,6 +537,9 @@ def _get_charset_prefix(pattern, flags):
         if not pattern.data:
             return None
         op, av = pattern.data[0]
+        if op is AT and _is_prefix_assertion(av, flags):
+            pattern = pattern[1:]
+            continue
         if op is not SUBPATTERN:
             break
         group, add_flags, del_flags, pattern = av
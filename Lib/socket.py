@@ -353,6 +353,7 @@ def makefile(self, mode="r", buffering=None, *,
         def _sendfile_use_sendfile(self, file, offset=0, count=None):
             # Lazy import to improve module import time
             import selectors
+            import stat
 
             self._check_sendfile_params(file, offset, count)
             sockno = self.fileno()
@@ -361,11 +362,23 @@ def _sendfile_use_sendfile(self, file, offset=0, count=None):
             except (AttributeError, io.UnsupportedOperation) as err:
                 raise _GiveupOnSendfile(err)  # not a regular file
             try:
-                fsize = os.fstat(fileno).st_size
+                st = os.fstat(fileno)
             except OSError as err:
                 raise _GiveupOnSendfile(err)  # not a regular file
-            if not fsize:
-                return 0  # empty file
+            # A pipe has no size and can't be read with sendfile(), but
+            # splice() moves its pages to the socket without a copy.
+            os_splice = getattr(os, 'splice', None)
+            use_splice = os_splice is not None and stat.S_ISFIFO(st.st_mode)
+            if use_splice:
+                if offset:
+                    raise _GiveupOnSendfile("can't seek in a pipe")
+                fsize = 2 ** 30
+            elif not stat.S_ISREG(st.st_mode):
+                raise _GiveupOnSendfile("not a regular file")
+            else:
+                fsize = st.st_size
+                if not fsize:
+                    return 0  # empty file
             # Truncate to 1GiB to avoid OverflowError, see bpo-38319.
             blocksize = min(count or fsize, 2 ** 30)
             timeout = self.gettimeout()
@@ -379,12 +392,34 @@ def _sendfile_use_sendfile(self, file, offset=0, count=None):
             else:
                 selector = selectors.SelectSelector()
             selector.register(sockno, selectors.EVENT_WRITE)
+            pipe_select = None
+            pipe_blocking = False
+            if use_splice and timeout:
+                # Reading from an empty pipe would block regardless of the
+                # socket timeout, so make the pipe non-blocking and wait
+                # for it to become readable instead.
+                pipe_blocking = os.get_blocking(fileno)
+                if pipe_blocking:
+                    os.set_blocking(fileno, False)
+                pipe_selector = type(selector)()
+                pipe_selector.register(fileno, selectors.EVENT_READ)
+                pipe_select = pipe_selector.select
 
             total_sent = 0
             # localize variable access to minimize overhead
             selector_select = selector.select
             os_sendfile = os.sendfile
             try:
+                if use_splice and hasattr(file, 'peek'):
+                    # Data already read into the buffer of the file object
+                    # is no longer in the pipe, so send it first.
+                    head = len(file.peek(1) or b'')
+                    if count:
+                        head = min(head, count)
+                    if head:
+                        data = file.read1(head)
+                        self.sendall(data)
+                        total_sent = len(data)
                 while True:
                     if timeout and not selector_select(timeout):
                         raise TimeoutError('timed out')
@@ -392,8 +427,14 @@ def _sendfile_use_sendfile(self, file, offset=0, count=None):
                         blocksize = min(count - total_sent, blocksize)
                         if blocksize <= 0:
                             break
+                    if pipe_select is not None and not pipe_select(timeout):
+                        raise TimeoutError('timed out')
                     try:
-                        sent = os_sendfile(sockno, fileno, offset, blocksize)
+                        if use_splice:
+                            sent = os_splice(fileno, sockno, blocksize)
+                        else:
+                            sent = os_sendfile(sockno, fileno, offset,
+                                               blocksize)
                     except BlockingIOError:
                         if not timeout:
                             # Block until the socket is ready to send some
@@ -415,7 +456,9 @@ def _sendfile_use_sendfile(self, file, offset=0, count=None):
                         total_sent += sent
                 return total_sent
             finally:
-                if total_sent > 0 and hasattr(file, 'seek'):
+                if pipe_blocking:
+                    os.set_blocking(fileno, True)
+                if total_sent > 0 and not use_splice and hasattr(file, 'seek'):
                     file.seek(offset)
     else:
         def _sendfile_use_sendfile(self, file, offset=0, count=None):
@@ -456,7 +499,9 @@ def _sendfile_use_send(self, file, offset=0, count=None):
             return total_sent
         finally:
             if total_sent > 0 and hasattr(file, 'seek'):
-                file.seek(offset + total_sent)
+                seekable = getattr(file, 'seekable', None)
+                if seekable is None or seekable():
+                    file.seek(offset + total_sent)
 
     def _check_sendfile_params(self, file, offset, count):
         if 'b' not in getattr(file, 'mode', 'b'):
@@ -480,6 +525,7 @@ def sendfile(self, file, offset=0, count=None):
         *file* must be a regular file object opened in binary mode.
         If os.sendfile() is not available (e.g. Windows) or file is
         not a regular file socket.send() will be used instead.
+        If file is a pipe, os.splice() is used when available.
         *offset* tells from where to start reading the file.
         If specified, *count* is the total number of bytes to transmit
         as opposed to sending the file until EOF is reached.
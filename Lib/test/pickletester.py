@@ -29,7 +29,7 @@
     TestFailed, run_with_locales, no_tracing,
     _2G, _4G, bigmemtest
     )
-from test.support.import_helper import forget
+from test.support.import_helper import forget, import_module
 from test.support.os_helper import TESTFN
 from test.support import threading_helper
 from test.support.warnings_helper import save_restore_warnings_filters
@@ -2364,6 +2364,22 @@ def persistent_id(self, obj):
             check({Clearer(): 1, Clearer(): 2})
             check({1: Clearer(), 2: Clearer()})
 
+    def test_evil_write_mutating_list(self):
+        # Committing a frame calls write(), which may mutate the list being
+        # pickled in the middle of a run of atoms.
+        def check(mutate):
+            lst = [float(i) for i in range(200_000)]
+            class EvilFile(io.BytesIO):
+                def write(self, data):
+                    mutate(lst)
+                    return super().write(data)
+            self.pickler(EvilFile(), proto).dump(lst)
+
+        for proto in range(4, pickle.HIGHEST_PROTOCOL + 1):
+            check(list.clear)
+            check(lambda lst: lst.__delitem__(slice(100_000, None)))
+            check(lambda lst: lst.extend([1.5, 'x', None]))
+
     @support.cpython_only
     def test_bad_ext_code(self):
         # This should never happen in normal circumstances, because the type
@@ -2895,6 +2911,24 @@ def test_float(self):
                 got = self.loads(pickle)
                 self.assert_is_copy(value, got)
 
+    def test_atoms_in_containers(self):
+        # Runs of atoms in lists and tuples may be written in bulk.
+        atoms = [None, True, False, 0.0, -1.5, 1e300, float('inf'),
+                 0, 1, 0xff, 0x100, 0xffff, 0x10000, -1, -0x100,
+                 2**31 - 1, -2**31, 2**31, -2**31 - 1, 2**64, MyInt(1),
+                 MyFloat(3.5), 'x', (), []]
+        data = [atoms, tuple(atoms), atoms * 40, tuple(atoms * 40),
+                [float(i) for i in range(2500)], list(range(-1200, 1300))]
+        for proto in protocols:
+            for value in data:
+                s = self.dumps(value, proto)
+                got = self.loads(s)
+                self.assert_is_copy(value, got)
+                if 2 <= proto < 4:
+                    # Same opcodes as the pure Python pickler.
+                    self.assertEqual(pickletools.optimize(s),
+                        pickletools.optimize(pickle._dumps(value, proto)))
+
     @run_with_locales('LC_ALL', 'de_DE', 'fr_FR', '')
     def test_float_format(self):
         # make sure that floats are formatted locale independent with proto 0
@@ -3585,6 +3619,28 @@ def test_framing_large_objects(self):
                     self.assertEqual(n_frames, 1)
                     self.check_frame_opcodes(pickled)
 
+    def test_fast_mode_globals(self):
+        # Fast mode does not memoize containers, but still memoizes globals,
+        # separately for each dump().
+        if not hasattr(self, 'pickler'):
+            self.skipTest('requires a Pickler class')
+        obj = [C(), C(), [C()]]
+        for proto in range(2, pickle.HIGHEST_PROTOCOL + 1):
+            with self.subTest(proto=proto):
+                buf = io.BytesIO()
+                pickler = self.pickler(buf, protocol=proto)
+                pickler.fast = True
+                pickler.dump(obj)
+                pickler.dump(obj)
+                buf.seek(0)
+                for _ in range(2):
+                    pos = buf.tell()
+                    self.assertEqual(self.unpickler(buf).load(), obj)
+                    pickled = buf.getvalue()[pos:buf.tell()]
+                    names = sum(count_opcode(op, pickled) for op in
+                                (pickle.GLOBAL, pickle.STACK_GLOBAL))
+                    self.assertEqual(names, 1)
+
     def test_optional_frames(self):
         if pickle.HIGHEST_PROTOCOL < 4:
             return
@@ -4399,6 +4455,27 @@ def test_load_from_and_dump_to_file(self):
         unpickled = self.load(stream)
         self.assertEqual(unpickled, data)
 
+    def test_load_from_mmap(self):
+        mmap = import_module('mmap')
+        big = bytes(range(256)) * 1000
+        data = [[123, big, 'abc', bytearray(big)], {'x': big[:10]}, 5]
+        for proto in protocols:
+            with self.subTest(proto=proto):
+                with open(TESTFN, 'wb+') as f:
+                    self.addCleanup(os_helper.unlink, TESTFN)
+                    f.write(b'junk')
+                    for obj in data:
+                        self.dump(obj, f, proto)
+                    f.flush()
+                    with mmap.mmap(f.fileno(), 0) as m:
+                        m.seek(4)
+                        for obj in data:
+                            self.assertEqual(self.load(m), obj)
+                        self.assertEqual(m.tell(), len(m))
+                        self.assertRaises(EOFError, self.load, m)
+                    # The mapping can be closed after an error.
+                    self.assertTrue(m.closed)
+
     def test_highest_protocol(self):
         # Of course this needs to be changed when HIGHEST_PROTOCOL changes.
         self.assertEqual(pickle.HIGHEST_PROTOCOL, 5)
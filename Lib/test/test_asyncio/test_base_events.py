@@ -257,6 +257,23 @@ def cb():
         self.assertIsInstance(h, asyncio.Handle)
         self.assertIn(h, self.loop._ready)
 
+    def test_call_soon_uses__call_soon(self):
+        # Subclasses and tests may override _call_soon().
+        def cb():
+            pass
+
+        handle = asyncio.Handle(cb, (), self.loop)
+        with mock.patch.object(self.loop, '_call_soon',
+                               return_value=handle) as m:
+            h = self.loop.call_soon(cb, 1, 2)
+        self.assertIs(h, handle)
+        m.assert_called_once_with(cb, (1, 2), None)
+
+    def test_call_soon_closed(self):
+        self.loop.close()
+        with self.assertRaisesRegex(RuntimeError, 'Event loop is closed'):
+            self.loop.call_soon(lambda: None)
+
     def test_call_soon_non_callable(self):
         self.loop.set_debug(True)
         with self.assertRaisesRegex(TypeError, 'a callable object'):
@@ -387,6 +404,21 @@ def test__run_once(self):
         self.assertEqual([h2], self.loop._scheduled)
         self.assertTrue(self.loop._process_events.called)
 
+    def test__run_once_no_timers(self):
+        # Without scheduled timers, the clock is not read and the ready
+        # callbacks are run in order.
+        calls = []
+        self.loop._process_events = mock.Mock()
+        self.loop.time = mock.Mock()
+        for i in range(3):
+            self.loop.call_soon(calls.append, i)
+        self.loop._run_once()
+
+        self.assertEqual(calls, [0, 1, 2])
+        self.assertEqual(self.loop._selector.select.call_args[0][0], 0)
+        self.assertFalse(self.loop.time.called)
+        self.assertFalse(self.loop._ready)
+
     def test_set_debug(self):
         self.loop.set_debug(True)
         self.assertTrue(self.loop.get_debug())
@@ -44,6 +44,19 @@ def list_to_buffer(l=()):
     return buffer
 
 
+def mock_recv_into(sock, data, addr=None):
+    # The transports receive into a scratch buffer with recv_into() or
+    # recvfrom_into(); make the mocked socket deliver *data* into it.
+    def recv_into(buf, nbytes=0):
+        buf[:len(data)] = data
+        if addr is None:
+            return len(data)
+        return len(data), addr
+    if addr is None:
+        sock.recv_into.side_effect = recv_into
+    else:
+        sock.recvfrom_into.side_effect = recv_into
+
 
 def close_transport(transport):
     # Don't call transport.close() because the event loop and the selector
@@ -572,7 +585,7 @@ def test_read_eof_received_error(self):
 
         self.protocol.eof_received.side_effect = LookupError()
 
-        self.sock.recv.return_value = b''
+        mock_recv_into(self.sock, b'')
         transport._read_ready()
 
         self.protocol.eof_received.assert_called_with()
@@ -585,7 +598,7 @@ def test_data_received_error(self):
         self.loop.call_exception_handler = mock.Mock()
         self.protocol.data_received.side_effect = LookupError()
 
-        self.sock.recv.return_value = b'data'
+        mock_recv_into(self.sock, b'data')
         transport._read_ready()
 
         self.assertTrue(transport._fatal_error.called)
@@ -594,7 +607,7 @@ def test_data_received_error(self):
     def test_read_ready(self):
         transport = self.socket_transport()
 
-        self.sock.recv.return_value = b'data'
+        mock_recv_into(self.sock, b'data')
         transport._read_ready()
 
         self.protocol.data_received.assert_called_with(b'data')
@@ -603,7 +616,7 @@ def test_read_ready_eof(self):
         transport = self.socket_transport()
         transport.close = mock.Mock()
 
-        self.sock.recv.return_value = b''
+        mock_recv_into(self.sock, b'')
         transport._read_ready()
 
         self.protocol.eof_received.assert_called_with()
@@ -613,7 +626,7 @@ def test_read_ready_eof_keep_open(self):
         transport = self.socket_transport()
         transport.close = mock.Mock()
 
-        self.sock.recv.return_value = b''
+        mock_recv_into(self.sock, b'')
         self.protocol.eof_received.return_value = True
         transport._read_ready()
 
@@ -622,7 +635,7 @@ def test_read_ready_eof_keep_open(self):
 
     @mock.patch('logging.exception')
     def test_read_ready_tryagain(self, m_exc):
-        self.sock.recv.side_effect = BlockingIOError
+        self.sock.recv_into.side_effect = BlockingIOError
 
         transport = self.socket_transport()
         transport._fatal_error = mock.Mock()
@@ -632,7 +645,7 @@ def test_read_ready_tryagain(self, m_exc):
 
     @mock.patch('logging.exception')
     def test_read_ready_tryagain_interrupted(self, m_exc):
-        self.sock.recv.side_effect = InterruptedError
+        self.sock.recv_into.side_effect = InterruptedError
 
         transport = self.socket_transport()
         transport._fatal_error = mock.Mock()
@@ -642,7 +655,7 @@ def test_read_ready_tryagain_interrupted(self, m_exc):
 
     @mock.patch('logging.exception')
     def test_read_ready_conn_reset(self, m_exc):
-        err = self.sock.recv.side_effect = ConnectionResetError()
+        err = self.sock.recv_into.side_effect = ConnectionResetError()
 
         transport = self.socket_transport()
         transport._force_close = mock.Mock()
@@ -652,7 +665,7 @@ def test_read_ready_conn_reset(self, m_exc):
 
     @mock.patch('logging.exception')
     def test_read_ready_err(self, m_exc):
-        err = self.sock.recv.side_effect = OSError()
+        err = self.sock.recv_into.side_effect = OSError()
 
         transport = self.socket_transport()
         transport._fatal_error = mock.Mock()
@@ -1073,7 +1086,7 @@ def test_proto_type_switch(self):
         self.protocol = test_utils.make_test_protocol(asyncio.Protocol)
         transport = self.socket_transport()
 
-        self.sock.recv.return_value = b'data'
+        mock_recv_into(self.sock, b'data')
         transport._read_ready()
 
         self.protocol.data_received.assert_called_with(b'data')
@@ -1086,6 +1099,7 @@ def test_proto_type_switch(self):
 
         transport.set_protocol(buf_proto)
 
+        self.sock.recv_into.side_effect = None
         self.sock.recv_into.return_value = 10
         transport._read_ready()
 
@@ -1214,7 +1228,7 @@ def datagram_transport(self, address=None):
     def test_read_ready(self):
         transport = self.datagram_transport()
 
-        self.sock.recvfrom.return_value = (b'data', ('0.0.0.0', 1234))
+        mock_recv_into(self.sock, b'data', ('0.0.0.0', 1234))
         transport._read_ready()
 
         self.protocol.datagram_received.assert_called_with(
@@ -1227,7 +1241,7 @@ def test_transport_inheritance(self):
     def test_read_ready_tryagain(self):
         transport = self.datagram_transport()
 
-        self.sock.recvfrom.side_effect = BlockingIOError
+        self.sock.recvfrom_into.side_effect = BlockingIOError
         transport._fatal_error = mock.Mock()
         transport._read_ready()
 
@@ -1236,7 +1250,7 @@ def test_read_ready_tryagain(self):
     def test_read_ready_err(self):
         transport = self.datagram_transport()
 
-        err = self.sock.recvfrom.side_effect = RuntimeError()
+        err = self.sock.recvfrom_into.side_effect = RuntimeError()
         transport._fatal_error = mock.Mock()
         transport._read_ready()
 
@@ -1247,7 +1261,7 @@ def test_read_ready_err(self):
     def test_read_ready_oserr(self):
         transport = self.datagram_transport()
 
-        err = self.sock.recvfrom.side_effect = OSError()
+        err = self.sock.recvfrom_into.side_effect = OSError()
         transport._fatal_error = mock.Mock()
         transport._read_ready()
 
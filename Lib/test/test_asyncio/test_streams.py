@@ -556,6 +556,38 @@ def test_readexactly_limit(self):
         self.assertEqual(b'chunk', data)
         self.assertEqual(b'', stream._buffer)
 
+    def test_readexactly_chunks_paused(self):
+        # readexactly() is only woken up once enough data has arrived, or
+        # when reading gets paused so that it can resume it.
+        stream = asyncio.StreamReader(limit=10, loop=self.loop)
+        chunks = [b'%02d' % i for i in range(50)]
+        paused = False
+
+        def feed():
+            while chunks and not paused:
+                stream.feed_data(chunks.pop(0))
+
+        def pause_reading():
+            nonlocal paused
+            paused = True
+
+        def resume_reading():
+            nonlocal paused
+            paused = False
+            self.loop.call_soon(feed)
+
+        transport = mock.Mock()
+        transport.pause_reading.side_effect = pause_reading
+        transport.resume_reading.side_effect = resume_reading
+        stream.set_transport(transport)
+        read_task = self.loop.create_task(stream.readexactly(100))
+        self.loop.call_soon(feed)
+
+        data = self.loop.run_until_complete(read_task)
+        self.assertEqual(data, b''.join(b'%02d' % i for i in range(50)))
+        self.assertEqual(b'', stream._buffer)
+        self.assertTrue(transport.pause_reading.called)
+
     def test_readexactly_eof(self):
         # Read exact number of bytes (eof).
         stream = asyncio.StreamReader(loop=self.loop)
@@ -1895,6 +1895,31 @@ def __getitem__(self, i):
                     return i
         self.assertRaises(ValueError, list, zip(BadSeq(), BadSeq()))
 
+    def test_zip_length_hint(self):
+        from operator import length_hint
+        self.assertEqual(length_hint(zip()), 0)
+        self.assertEqual(length_hint(zip([1, 2, 3], (4, 5))), 2)
+        z = zip(range(5), 'abcd', [6, 7, 8, 9, 10])
+        self.assertEqual(length_hint(z), 4)
+        next(z)
+        self.assertEqual(length_hint(z), 3)
+        list(z)
+        self.assertEqual(length_hint(z), 0)
+        # No estimate if the length of any argument is unknown.
+        def gen():
+            yield 1
+        self.assertEqual(length_hint(zip(range(10), gen()), -1), -1)
+        self.assertEqual(length_hint(zip(gen(), range(10)), -1), -1)
+
+        class BadHint:
+            def __iter__(self):
+                return self
+            def __next__(self):
+                raise StopIteration
+            def __length_hint__(self):
+                raise RuntimeError
+        self.assertRaises(RuntimeError, length_hint, zip([1], BadHint()))
+
     def test_zip_pickle(self):
         a = (1, 2, 3)
         b = (4, 5, 6)
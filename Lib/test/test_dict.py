@@ -182,6 +182,36 @@ def __hash__(self):
         x.fail = True
         self.assertRaises(Exc, d.__getitem__, x)
 
+    def test_getitem_int_keys(self):
+        # Use non-cached ints, so that lookups can't succeed by identity.
+        big = int('1000')
+        d = {big: 'a', -1: 'b', -2: 'c', 2**62: 'd', 2**100: 'e'}
+        self.assertEqual(d[int('1000')], 'a')
+        self.assertEqual(d[int('-1')], 'b')
+        self.assertEqual(d[int('-2')], 'c')
+        self.assertEqual(d[int('4611686018427387904')], 'd')
+        self.assertEqual(d[2**100], 'e')
+        self.assertNotIn(int('1001'), d)
+        self.assertNotIn(int('-3'), d)
+
+        # Equal keys of other types must still be found.
+        d = {1000.0: 'f', True: 'g', 2**62 + 0.0: 'h'}
+        self.assertEqual(d[int('1000')], 'f')
+        self.assertEqual(d[int('1')], 'g')
+        self.assertEqual(d[2**62], 'h')
+
+        class IntLike:
+            def __init__(self, value):
+                self.value = value
+            def __hash__(self):
+                return hash(self.value)
+            def __eq__(self, other):
+                return self.value == other
+
+        d = {IntLike(1000): 'i'}
+        self.assertEqual(d[int('1000')], 'i')
+        self.assertNotIn(int('1001'), d)
+
     def test_clear(self):
         d = {1:1, 2:2, 3:3}
         d.clear()
@@ -265,6 +295,40 @@ def __next__(self):
 
         self.assertRaises(ValueError, {}.update, [(1, 2, 3)])
 
+    def test_constructor_presized(self):
+        # dict() and dict.fromkeys() presize the table from a length hint.
+        keys = [str(i) for i in range(1000)]
+        values = list(range(1000))
+        expected = {k: v for k, v in zip(keys, values)}
+        self.assertEqual(dict(zip(keys, values)), expected)
+        self.assertEqual(dict(zip(values, keys)),
+                         {v: k for k, v in zip(keys, values)})
+        self.assertEqual(dict(list(zip(keys, values))), expected)
+        self.assertEqual(dict.fromkeys(keys), dict.fromkeys(iter(keys)))
+        self.assertEqual(list(dict.fromkeys(values, 0)), values)
+
+        # The first key decides the initial keys kind; later keys of
+        # another kind must still be handled.
+        mixed = ['a'] + values
+        self.assertEqual(list(dict(zip(mixed, mixed))), mixed)
+        self.assertEqual(list(dict.fromkeys(mixed)), mixed)
+
+        # A wrong hint is harmless.
+        class Hint:
+            def __init__(self, items, hint):
+                self.it = iter(items)
+                self.hint = hint
+            def __iter__(self):
+                return self
+            def __next__(self):
+                return next(self.it)
+            def __length_hint__(self):
+                return self.hint
+        for hint in (0, 1, 5, 10**6, sys.maxsize):
+            self.assertEqual(dict(Hint(expected.items(), hint)), expected)
+            self.assertEqual(dict.fromkeys(Hint(keys, hint)),
+                             dict.fromkeys(keys))
+
     def test_fromkeys(self):
         self.assertEqual(dict.fromkeys('abc'), {'a':None, 'b':None, 'c':None})
         d = {}
@@ -21,6 +21,7 @@
 """
 Tests for epoll wrapper.
 """
+import array
 import errno
 import os
 import select
@@ -213,6 +214,50 @@ def test_control_and_wait(self):
         expected = [(server.fileno(), select.EPOLLOUT)]
         self.assertEqual(events, expected)
 
+    def test_poll_into(self):
+        client, server = self._connected_pair()
+        ep = select.epoll(16)
+        ep.register(server.fileno(), select.EPOLLIN | select.EPOLLOUT)
+        ep.register(client.fileno(), select.EPOLLIN | select.EPOLLOUT)
+        client.sendall(b"Hello!")
+        server.sendall(b"world!!!")
+
+        expected = [(client.fileno(), select.EPOLLIN | select.EPOLLOUT),
+                    (server.fileno(), select.EPOLLIN | select.EPOLLOUT)]
+        for _ in support.busy_retry(support.SHORT_TIMEOUT):
+            if sorted(ep.poll(0)) == expected:
+                break
+
+        buf = array.array('Q', [0xff] * 5)
+        self.assertEqual(ep.poll_into(buf, 1), 2)
+        events = list(zip(buf[0:4:2], buf[1:4:2]))
+        self.assertEqual(sorted(events), expected)
+        self.assertEqual(buf[4], 0xff)
+
+        # maxevents is len(buffer) // 2
+        buf = array.array('Q', [0, 0, 0])
+        self.assertEqual(ep.poll_into(buf, timeout=0), 1)
+        self.assertIn((buf[0], buf[1]), expected)
+
+        # any writable buffer with room for an event is accepted
+        buf = bytearray(17)
+        self.assertEqual(ep.poll_into(memoryview(buf)[1:]), 1)
+        self.assertIn(tuple(memoryview(buf)[1:].cast('Q')), expected)
+
+        ep.unregister(client.fileno())
+        ep.unregister(server.fileno())
+        buf = array.array('Q', [0, 0])
+        self.assertEqual(ep.poll_into(buf, 0.01), 0)
+
+    def test_poll_into_errors(self):
+        ep = select.epoll()
+        self.assertRaises(ValueError, ep.poll_into, array.array('Q', [0]))
+        self.assertRaises(ValueError, ep.poll_into, bytearray(15))
+        self.assertRaises(TypeError, ep.poll_into, bytes(16))
+        self.assertRaises(TypeError, ep.poll_into, bytearray(16), 'x')
+        ep.close()
+        self.assertRaises(ValueError, ep.poll_into, bytearray(16))
+
     def test_errors(self):
         self.assertRaises(ValueError, select.epoll, -2)
         self.assertRaises(ValueError, select.epoll().register, -1,
@@ -568,6 +568,37 @@ def testAppend(self):
             except:
                 pass
 
+    def testTellAfterOpen(self):
+        self.addCleanup(os.unlink, TESTFN)
+        with self.FileIO(TESTFN, 'w') as f:
+            self.assertEqual(f.tell(), 0)
+            f.write(b'spam')
+            self.assertEqual(f.tell(), 4)
+        with self.FileIO(TESTFN, 'a') as f:
+            self.assertEqual(f.tell(), 4)
+        with self.FileIO(TESTFN, 'r') as f:
+            self.assertEqual(f.tell(), 0)
+            f.read(1)
+            self.assertEqual(f.tell(), 1)
+        with self.FileIO(TESTFN, 'r') as f:
+            self.assertTrue(f.seekable())
+            self.assertEqual(f.tell(), 0)
+            f.seek(0, os.SEEK_CUR)
+            self.assertEqual(f.tell(), 0)
+        with self.FileIO(TESTFN, 'r') as f:
+            f.readall()
+            self.assertEqual(f.tell(), 4)
+        with self.FileIO(TESTFN, 'r') as f:
+            # The position can be moved through the file descriptor
+            os.lseek(f.fileno(), 2, os.SEEK_SET)
+            self.assertEqual(f.tell(), 2)
+        def opener(path, flags):
+            fd = os.open(path, flags)
+            os.lseek(fd, 3, os.SEEK_SET)
+            return fd
+        with self.FileIO(TESTFN, 'r', opener=opener) as f:
+            self.assertEqual(f.tell(), 3)
+
     def testInvalidInit(self):
         self.assertRaises(TypeError, self.FileIO, "1", 0, 0)
 
@@ -13,6 +13,11 @@
 except ImportError:
     _testcapi = None
 
+try:
+    import _testinternalcapi
+except ImportError:
+    _testinternalcapi = None
+
 from test.support import threading_helper
 
 
@@ -142,6 +147,53 @@ def writer_func(l):
             for ref in thread_list:
                 self.assertIsNone(ref())
 
+    def test_racing_reads_shared_table(self):
+        """Concurrent first reads of a dict built by another thread should
+        see every entry, with str, int and object keys"""
+        THREAD_COUNT = 8
+        N = 1000
+
+        tables = [
+            {f"k{i}": [i] for i in range(N)},
+            {i * 1000: [i] for i in range(N)},
+            {(i,): [i] for i in range(N)},
+        ]
+        keys = [list(t) for t in tables]
+        errors = []
+
+        def reader_func():
+            for table, table_keys in zip(tables, keys):
+                for i, key in enumerate(table_keys):
+                    if table[key] != [i] or table.get(key) != [i]:
+                        errors.append((key, table.get(key)))
+
+        threads = [Thread(target=reader_func) for _ in range(THREAD_COUNT)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+
+        self.assertEqual(errors, [])
+        del tables, keys
+        gc.collect()
+
+    @unittest.skipUnless(hasattr(_testinternalcapi, 'can_incref_shared'),
+                         'requires _testinternalcapi.can_incref_shared')
+    def test_first_read_shares_entry(self):
+        """After a locked first read from another thread, the key and value
+        of that entry, and only those, can be read without locking"""
+        can_incref_shared = _testinternalcapi.can_incref_shared
+        for table in ({(i,): [i] for i in range(100)},
+                      {f"k{i}": [i] for i in range(100)}):
+            keys = list(table)
+            thread = Thread(target=lambda: table[keys[5]])
+            thread.start()
+            thread.join()
+            self.assertTrue(can_incref_shared(keys[5]))
+            self.assertTrue(can_incref_shared(table[keys[5]]))
+            self.assertFalse(can_incref_shared(keys[6]))
+            self.assertFalse(can_incref_shared(table[keys[6]]))
+
 
 if __name__ == "__main__":
     unittest.main()
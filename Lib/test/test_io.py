@@ -1513,6 +1513,21 @@ def bufio():
         self.assertEqual(bufio().readlines(5), [b"abc\n", b"d\n"])
         self.assertEqual(bufio().readlines(None), [b"abc\n", b"d\n", b"ef"])
 
+    def test_readline_across_reads(self):
+        # Lines split between several raw reads.
+        raw_data = (b"ab", b"c", b"d\nef", b"ghij", b"k\n", b"lmnopqr",
+                    b"stuvwxyz", b"\n")
+        for limit in (-1, 5, 100):
+            with self.subTest(limit=limit):
+                bufio = self.tp(self.MockRawIO(raw_data), buffer_size=16)
+                lines = []
+                while line := bufio.readline(limit):
+                    lines.append(line)
+                self.assertEqual(b"".join(lines), b"".join(raw_data))
+                for line in lines:
+                    if limit < 0 or len(line) < limit:
+                        self.assertTrue(line.endswith(b"\n"), line)
+
     def test_buffering(self):
         data = b"abcdefghi"
         dlen = len(data)
@@ -3007,6 +3022,26 @@ def test_newlines_input(self):
             txt.seek(0)
             self.assertEqual(txt.read(), "".join(expected))
 
+    def test_newlines_long_lines(self):
+        # Lines longer than the chunk size, and newlines of each kind
+        # appearing for the first time far into the stream.
+        lines = ['a' * 1000 + '\n', 'b' * 300 + '\r\n', 'c' * 5000 + '\r',
+                 '\xe9' * 700 + '\r\n', 'd' * 10 + '\n', '\r', 'f\n', 'e']
+        text = ''.join(lines)
+        for newline, expected, newlines in [
+            (None, [l.rstrip('\r\n') + '\n' for l in lines[:-1]] + ['e'],
+             ('\r', '\n', '\r\n')),
+            ('', lines, ('\r', '\n', '\r\n')),
+            ]:
+            for encoding in ('latin-1', 'utf-8'):
+                buf = self.BytesIO(text.encode(encoding))
+                txt = self.TextIOWrapper(buf, encoding=encoding,
+                                         newline=newline)
+                self.assertEqual(txt.readlines(), expected)
+                self.assertEqual(txt.newlines, newlines)
+                txt.seek(0)
+                self.assertEqual(txt.read(), ''.join(expected))
+
     def test_newlines_output(self):
         testdict = {
             "": b"AAA\nBBB\nCCC\nX\rY\r\nZ",
@@ -89,6 +89,38 @@ def test_keys_reuse(self):
         self.check_keys_reuse(s, decoder.decode)
         self.assertFalse(decoder.memo)
 
+    def test_iterdecode(self):
+        decoder = self.json.JSONDecoder()
+        text = '{"a": [1, 2, "x\\"\xe9"]}\n12\n"s"  true null -3.5e3 [] {}\n7'
+        expected = [{"a": [1, 2, 'x"\xe9']}, 12, "s", True, None, -3500.0,
+                    [], {}, 7]
+        data = text.encode()
+        for n in range(1, 12):
+            with self.subTest(n=n):
+                chunks = [text[i:i+n] for i in range(0, len(text), n)]
+                self.assertEqual(list(decoder.iterdecode(chunks)), expected)
+                chunks = [data[i:i+n] for i in range(0, len(data), n)]
+                self.assertEqual(list(decoder.iterdecode(chunks)), expected)
+        self.assertEqual(list(decoder.iterdecode([])), [])
+        self.assertEqual(list(decoder.iterdecode([' \n', b''])), [])
+
+    def test_iterdecode_lazy(self):
+        # Documents are produced as soon as they are complete.
+        decoder = self.json.JSONDecoder()
+        it = decoder.iterdecode(iter(['[1]\n[', '2]\n', '3', '4\n', 'x']))
+        self.assertEqual(next(it), [1])
+        self.assertEqual(next(it), [2])
+        self.assertEqual(next(it), 34)
+        self.assertRaises(self.JSONDecodeError, next, it)
+
+    def test_iterdecode_errors(self):
+        decoder = self.json.JSONDecoder()
+        for chunks in (['[1,', ' x]\n', '[2]'], ['[1, x]\n[2]'], ['[1]', ' ['],
+                       ['"abc'], ['1.'], [b'[1]\n\xff'], ['[1]]']):
+            with self.subTest(chunks=chunks):
+                with self.assertRaises(ValueError):
+                    list(decoder.iterdecode(chunks))
+
     def test_extra_data(self):
         s = '[1, 2, 3]5'
         msg = 'Extra data'
@@ -132,4 +164,20 @@ def test_limit_int(self):
 
 
 class TestPyDecode(TestDecode, PyTest): pass
-class TestCDecode(TestDecode, CTest): pass
+class TestCDecode(TestDecode, CTest):
+    def test_keys_reuse_across_calls(self):
+        decoder = self.json.decoder.JSONDecoder()
+        a = decoder.decode('{"a_key\xe9": 1}')
+        b = decoder.decode('[{"a_key\xe9": 2}]')
+        self.assertIs(next(iter(a)), next(iter(b[0])))
+        # The cache is bounded.
+        decoder.decode(self.dumps({str(i): i for i in range(10000)}))
+        c = decoder.decode('{"a_key\xe9": 3}')
+        self.assertIsNot(next(iter(a)), next(iter(c)))
+        # So is the total size of the keys it holds.
+        key = 'k' * 100_000
+        a = decoder.decode(self.dumps({key: 1}))
+        b = decoder.decode(self.dumps({key: 2}))
+        self.assertEqual(a, {key: 1})
+        self.assertIsNot(next(iter(a)), next(iter(b)))
+
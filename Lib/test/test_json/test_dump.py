@@ -57,11 +57,62 @@ def __lt__(self, o):
         d[1337] = "true.dat"
         self.assertEqual(self.dumps(d, sort_keys=True), '{"1337": "true.dat"}')
 
+    def test_iterencode_large(self):
+        data = {"x": [{"a": i, "b": [1.5, None, True, "\xe9\n"], "c": {}}
+                      for i in range(2500)],
+                "y": list(range(2500)),
+                "z": {str(i): [i] for i in range(2500)}}
+        for kwargs in ({}, {'indent': 2, 'sort_keys': True},
+                       {'separators': (',', ':'), 'ensure_ascii': False}):
+            with self.subTest(**kwargs):
+                encoder = self.json.JSONEncoder(**kwargs)
+                chunks = list(encoder.iterencode(data))
+                self.assertEqual(''.join(chunks), self.dumps(data, **kwargs))
+                sio = StringIO()
+                self.json.dump(data, sio, **kwargs)
+                self.assertEqual(sio.getvalue(), ''.join(chunks))
+
+    def test_iterencode_circular(self):
+        lst = []
+        lst.append([lst])
+        with self.assertRaises(ValueError):
+            list(self.json.JSONEncoder().iterencode([lst] * 2000))
+
 
 class TestPyDump(TestDump, PyTest): pass
 
 class TestCDump(TestDump, CTest):
 
+    def test_iterencode_chunks(self):
+        # Small subtrees are encoded in one chunk by the C encoder, large
+        # containers are still split.
+        data = {"x": [{"a": i, "b": [1, 2]} for i in range(5000)]}
+        chunks = list(self.json.JSONEncoder().iterencode(data))
+        self.assertEqual(len(chunks), 5000 + 5)
+        self.assertEqual(chunks[10], ', {"a": 7, "b": [1, 2]}')
+
+    def test_iterencode_default_large(self):
+        # Whatever default() returns is iterated over like any other value.
+        class Big:
+            pass
+        encoder = self.json.JSONEncoder(default=lambda o: list(range(5000)))
+        for data in (Big(), {'a': [Big()]}, [1, Big()]):
+            with self.subTest(data=data):
+                chunks = list(encoder.iterencode(data))
+                self.assertGreater(len(chunks), 5000)
+                self.assertEqual(''.join(chunks), encoder.encode(data))
+
+    def test_iterencode_nested_large(self):
+        # A small container wrapping a large one is still split.
+        data = [[{"a": list(range(5000))}]]
+        chunks = list(self.json.JSONEncoder().iterencode(data))
+        self.assertGreater(len(chunks), 5000)
+        self.assertEqual(''.join(chunks), self.dumps(data))
+        data = [[list(range(600)), list(range(600))]]
+        chunks = list(self.json.JSONEncoder().iterencode(data))
+        self.assertLessEqual(max(chunk.count(',') for chunk in chunks), 600)
+        self.assertEqual(''.join(chunks), self.dumps(data))
+
     # The size requirement here is hopefully over-estimated (actual
     # memory consumption depending on implementation details, and also
     # system memory management, since this may allocate a lot of
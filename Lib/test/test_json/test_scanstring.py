@@ -142,6 +142,27 @@ def test_bad_escapes(self):
             with self.assertRaises(self.JSONDecodeError, msg=s):
                 scanstring(s, 1, True)
 
+    def test_special_at_any_offset(self):
+        # Quotes, backslashes and control characters must be found wherever
+        # they fall relative to the chunks the scanner reads at once.
+        scanstring = self.json.decoder.scanstring
+        for n in range(20):
+            text = 'x' * n
+            for tail in '"', '\\n"', '\\"y"':
+                with self.subTest(n=n, tail=tail):
+                    s = '"' + text + tail + 'z' * 20
+                    expected = text + tail[:-1].replace('\\n', '\n').replace('\\"', '"')
+                    self.assertEqual(scanstring(s, 1, True),
+                                     (expected, len(text) + len(tail) + 1))
+            s = '"' + text + '\x1f' + 'z' * 20 + '"'
+            with self.assertRaises(self.JSONDecodeError):
+                scanstring(s, 1, True)
+            self.assertEqual(scanstring(s, 1, False), (s[1:-1], len(s)))
+            s = '"' + text + '\xff' * 20
+            with self.assertRaises(self.JSONDecodeError) as cm:
+                scanstring(s, 1, True)
+            self.assertEqual(cm.exception.pos, 0)
+
     def test_overflow(self):
         with self.assertRaises(OverflowError):
             self.json.decoder.scanstring(b"xxx", sys.maxsize+1)
@@ -112,6 +112,25 @@ def test_branching(self):
         self.assertEqual(re.match('((a)|(b)|(c))', 'b').span(), (0, 1))
         self.assertEqual(re.match('((a)|(b)|(c))', 'c').span(), (0, 1))
 
+    def test_branching_common_literals(self):
+        # Alternatives starting with the same literal are grouped, but the
+        # first alternative that matches still wins.
+        self.assertEqual(re.match('ab|b|a|abc', 'abc').group(), 'ab')
+        self.assertEqual(re.match('b|a|abc|ab', 'abc').group(), 'a')
+        self.assertEqual(re.match('abd|x?|abc', 'abc').group(), '')
+        self.assertEqual(re.match('abd|a.|abc', 'abc').group(), 'ab')
+        self.assertEqual(re.match('(ab)d|(ab)c|(a)', 'abc').groups(),
+                         (None, 'ab', None))
+        self.assertEqual(re.match('ab|Ab|Abc', 'Abc', re.I).group(), 'Ab')
+        self.assertEqual(re.match('ab|Abc|ac', 'ABC', re.I).group(), 'AB')
+        words = ['foo', 'foobar', 'fob', 'bar', 'baz', 'f', 'ba']
+        text = 'foobar fob fox bazz barfoo'
+        self.assertEqual(re.findall('|'.join(words), text),
+                         ['foo', 'bar', 'fob', 'f', 'baz', 'bar', 'foo'])
+        self.assertEqual(re.findall('|'.join(sorted(words, key=len,
+                                                    reverse=True)), text),
+                         ['foobar', 'fob', 'f', 'baz', 'bar', 'foo'])
+
     def bump_num(self, matchobj):
         int_value = int(matchobj.group(0))
         return str(int_value + 1)
@@ -1297,6 +1316,42 @@ def test_search_coverage(self):
         self.assertEqual(re.search(r"\s(b)", " b").group(1), "b")
         self.assertEqual(re.search(r"a\s", "a ").group(0), "a ")
 
+    def test_findall_growing_stack(self):
+        # Later matches reuse and grow the backtracking stack of earlier ones.
+        s = 'ab ' + 'ab' * 10000 + ' ab ' + 'ba' * 10000
+        self.assertEqual([m.span() for m in re.finditer(r'(?:a|(b))+', s)],
+                         [(0, 2), (3, 20003), (20004, 20006), (20007, 40007)])
+        self.assertEqual(re.findall(r'(?:a|(b))+', s), ['b'] * 4)
+
+    def test_search_prefix_after_assertion(self):
+        # A literal prefix after \b, \B or a multiline ^ is searched for,
+        # and the assertion is checked where it is found.
+        for s in ('xfoo1 foo2', 'xfoo1 foo2'.encode(), 'xfoo1 foo2\u20ac'):
+            p = r'\bfoo(\d)'
+            if isinstance(s, bytes):
+                p = p.encode()
+            self.assertEqual(re.search(p, s).span(), (6, 10))
+            self.assertEqual(len(re.findall(p, s)), 1)
+        self.assertEqual(re.search(r'\Boo', 'oo foo').span(), (4, 6))
+        self.assertEqual(re.search(r'a(\bb|c)', 'ab ac a b').span(), (3, 5))
+        self.assertEqual(re.search(r'(?m)^ab', 'cab\nab').span(), (4, 6))
+        self.assertIsNone(re.search(r'(?m)^ab', 'cab\ncab'))
+        self.assertEqual(re.search(r'\b(ERROR|WARN)', 'xERROR WARN').span(),
+                         (7, 11))
+
+    def test_search_charset_long_text(self):
+        # Long stretches without a candidate switch to a lookup table.
+        for prefix in ('x' * 1000, 'x' * 999 + '\u20ac',
+                       'x' * 999 + '\U0001f600'):
+            s = prefix + ' WARN ' + prefix + '\xe9RROR'
+            self.assertEqual(re.findall('[EW][AR]R', s), ['WAR'])
+            self.assertEqual(re.findall('[EW\xe9][AR]R', s),
+                             ['WAR', '\xe9RR'])
+            self.assertEqual(re.findall('[^x]RR', s), ['\xe9RR'])
+            self.assertEqual(re.findall('(?i)[e\xc9]rr', s), ['\xe9RR'])
+        s = b'x' * 1000 + b'\xe9RROR'
+        self.assertEqual(re.findall(b'[\xe9W]RR', s), [b'\xe9RR'])
+
     def assertMatch(self, pattern, text, match=None, span=None,
                     matcher=re.fullmatch):
         if match is None and span is None:
@@ -2815,6 +2815,68 @@ def _testRecvFromNegative(self):
         self.cli.sendto(MSG, 0, (HOST, self.port))
 
 
+@requireAttrs(socket.socket, 'recvmmsg_into', 'sendmmsg')
+class MultipleMessagesUDPTest(ThreadedUDPSocketTest):
+    # Tests for recvmmsg_into() and sendmmsg().
+
+    msgs = [b'first', b'second', b'third']
+
+    def recvAll(self, count, size=64):
+        # recvmmsg_into() returns as soon as one datagram is available,
+        # so keep calling it until all the expected datagrams arrived.
+        result = []
+        while len(result) < count:
+            bufs = [bytearray(size) for _ in range(count - len(result))]
+            for nbytes, addr in self.serv.recvmmsg_into(bufs):
+                self.assertEqual(addr[0], self.serv.getsockname()[0])
+                result.append(bytes(bufs.pop(0)[:nbytes]))
+        return result
+
+    def testSendmmsgRecvmmsgInto(self):
+        self.assertEqual(self.recvAll(len(self.msgs)), self.msgs)
+
+    def _testSendmmsgRecvmmsgInto(self):
+        self.assertEqual(
+            self.cli.sendmmsg(self.msgs, 0, (HOST, self.port)),
+            len(self.msgs))
+
+    def testSendmmsgConnected(self):
+        self.assertEqual(self.recvAll(2), [b'x', MSG])
+
+    def _testSendmmsgConnected(self):
+        self.cli.connect((HOST, self.port))
+        self.assertEqual(
+            self.cli.sendmmsg([bytearray(b'x'), memoryview(MSG)]), 2)
+
+    def testRecvmmsgIntoTruncated(self):
+        buf = bytearray(3)
+        (nbytes, addr), = self.serv.recvmmsg_into([buf])
+        self.assertEqual(nbytes, 3)
+        self.assertEqual(buf, MSG[:3])
+
+    def _testRecvmmsgIntoTruncated(self):
+        self.cli.sendto(MSG, (HOST, self.port))
+
+    def testRecvmmsgIntoBadArgs(self):
+        self.assertRaises(ValueError, self.serv.recvmmsg_into, [])
+        self.assertRaises(TypeError, self.serv.recvmmsg_into, 1)
+        self.assertRaises(TypeError, self.serv.recvmmsg_into, [b'ro'])
+        self.assertRaises(TypeError, self.serv.sendmmsg, 1)
+        self.assertRaises(TypeError, self.serv.sendmmsg, ['str'])
+        self.assertEqual(self.serv.sendmmsg([]), 0)
+
+    def _testRecvmmsgIntoBadArgs(self):
+        pass
+
+    def testRecvmmsgIntoTimeout(self):
+        self.serv.settimeout(0.01)
+        self.assertRaises(TimeoutError,
+                          self.serv.recvmmsg_into, [bytearray(10)])
+
+    def _testRecvmmsgIntoTimeout(self):
+        pass
+
+
 @unittest.skipUnless(HAVE_SOCKET_UDPLITE,
           'UDPLITE sockets required for this test.')
 class BasicUDPLITETest(ThreadedUDPLITESocketTest):
@@ -6441,6 +6503,78 @@ def testNonRegularFile(self):
         self.assertEqual(len(data), self.FILESIZE)
         self.assertEqual(data, self.FILEDATA)
 
+    # pipe
+
+    PIPEDATA_SIZE = 1024 * 1024  # 1 MiB
+
+    def _testPipe(self):
+        address = self.serv.getsockname()
+        r, w = os.pipe()
+        data = self.FILEDATA[:self.PIPEDATA_SIZE]
+        def writer():
+            with open(w, 'wb') as f:
+                f.write(data)
+        thread = threading.Thread(target=writer)
+        file = open(r, 'rb')
+        with socket.create_connection(address) as sock, file as file:
+            thread.start()
+            meth = self.meth_from_sock(sock)
+            sent = meth(file)
+            self.assertEqual(sent, len(data))
+        thread.join()
+
+    def testPipe(self):
+        conn = self.accept_conn()
+        data = self.recv_data(conn)
+        self.assertEqual(len(data), self.PIPEDATA_SIZE)
+        self.assertEqual(data, self.FILEDATA[:self.PIPEDATA_SIZE])
+
+    def _testPipeBuffered(self):
+        # Data already in the buffer of the file object must be sent first.
+        address = self.serv.getsockname()
+        r, w = os.pipe()
+        data = self.FILEDATA[:self.PIPEDATA_SIZE]
+        def writer():
+            with open(w, 'wb') as f:
+                f.write(data)
+        thread = threading.Thread(target=writer)
+        file = open(r, 'rb')
+        with socket.create_connection(address) as sock, file as file:
+            thread.start()
+            self.assertEqual(file.read(10), data[:10])
+            meth = self.meth_from_sock(sock)
+            sent = meth(file, count=len(data) - 20)
+            self.assertEqual(sent, len(data) - 20)
+            self.assertEqual(file.read(), data[-10:])
+        thread.join()
+
+    def testPipeBuffered(self):
+        conn = self.accept_conn()
+        data = self.recv_data(conn)
+        self.assertEqual(data, self.FILEDATA[10:self.PIPEDATA_SIZE - 10])
+
+    # file object without seekable()
+
+    def _testNoSeekable(self):
+        class File:
+            mode = 'rb'
+            def __init__(self, data):
+                self._file = io.BytesIO(data)
+                self.read = self._file.read
+                self.seek = self._file.seek
+                self.tell = self._file.tell
+        address = self.serv.getsockname()
+        file = File(self.FILEDATA)
+        with socket.create_connection(address) as sock:
+            sent = sock.sendfile(file, count=1000)
+            self.assertEqual(sent, 1000)
+            self.assertEqual(file.tell(), 1000)
+
+    def testNoSeekable(self):
+        conn = self.accept_conn()
+        data = self.recv_data(conn)
+        self.assertEqual(data, self.FILEDATA[:1000])
+
     # empty file
 
     def _testEmptyFileSend(self):
@@ -6626,6 +6760,66 @@ class SendfileUsingSendfileTest(SendfileUsingSendTest):
     def meth_from_sock(self, sock):
         return getattr(sock, "_sendfile_use_sendfile")
 
+    # empty pipe with a timeout
+
+    @unittest.skipUnless(hasattr(os, 'splice'), 'test needs os.splice()')
+    def _testPipeWithTimeout(self):
+        address = self.serv.getsockname()
+        r, w = os.pipe()
+        with open(r, 'rb') as file, open(w, 'wb'):
+            with socket.create_connection(address) as sock:
+                sock.settimeout(0.01)
+                meth = self.meth_from_sock(sock)
+                self.assertRaises(TimeoutError, meth, file)
+            self.assertTrue(os.get_blocking(r))
+
+    @unittest.skipUnless(hasattr(os, 'splice'), 'test needs os.splice()')
+    def testPipeWithTimeout(self):
+        conn = self.accept_conn()
+        self.assertEqual(conn.recv(1), b'')
+
+
+@unittest.skipUnless(hasattr(socket, 'SO_ZEROCOPY'), 'SO_ZEROCOPY required')
+class ZeroCopySendTest(unittest.TestCase):
+
+    def test_errqueue_notification(self):
+        with socket.create_server((HOST, 0)) as srv, \
+             socket.create_connection(srv.getsockname()) as cli:
+            conn, _ = srv.accept()
+            self.addCleanup(conn.close)
+            try:
+                cli.setsockopt(socket.SOL_SOCKET, socket.SO_ZEROCOPY, 1)
+            except OSError as err:
+                self.skipTest(f'SO_ZEROCOPY not supported: {err}')
+            data = b'x' * 65536
+            sent = cli.send(data, socket.MSG_ZEROCOPY)
+            received = b''
+            while len(received) < sent:
+                received += conn.recv(sent - len(received))
+            self.assertEqual(received, data[:sent])
+
+            # The completion is queued on the error queue of the sender.
+            for _ in support.sleeping_retry(support.SHORT_TIMEOUT):
+                try:
+                    msg, ancdata, flags, addr = cli.recvmsg(
+                        0, 1024, socket.MSG_ERRQUEUE)
+                    break
+                except BlockingIOError:
+                    pass
+            self.assertTrue(flags & socket.MSG_ERRQUEUE)
+            self.assertEqual(len(ancdata), 1)
+            level, type, cmsg_data = ancdata[0]
+            self.assertEqual((level, type),
+                             (socket.IPPROTO_IP, socket.IP_RECVERR))
+            # struct sock_extended_err: the error is 0, the origin is
+            # SO_EE_ORIGIN_ZEROCOPY and ee_info..ee_data is the range of
+            # completed sends, here only the first one.
+            ee_errno, ee_origin, _, _, _, ee_info, ee_data = struct.unpack(
+                '=IBBBBII', cmsg_data[:16])
+            self.assertEqual(ee_errno, 0)
+            self.assertEqual(ee_origin, 5)
+            self.assertEqual((ee_info, ee_data), (0, 0))
+
 
 @unittest.skipUnless(HAVE_SOCKET_ALG, 'AF_ALG required')
 class LinuxKernelCryptoAPI(unittest.TestCase):
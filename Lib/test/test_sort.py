@@ -405,6 +405,48 @@ def test_none_in_tuples(self):
         actual = sorted([(None, 2), (None, 1)])
         self.assertEqual(actual, expected)
 
+class TestParallelSort(unittest.TestCase):
+    # Three chunks of PARALLEL_SORT_MIN_CHUNK items when parallel sorting
+    # is supported; elsewhere the parallel argument is simply ignored.
+    n = 3 << 15
+
+    def check(self, data, **kwargs):
+        expected = sorted(data, **kwargs)
+        for parallel in (0, 4):
+            with self.subTest(parallel=parallel, **kwargs):
+                actual = data[:]
+                actual.sort(parallel=parallel, **kwargs)
+                self.assertEqual(actual, expected)
+
+    def test_types(self):
+        rand = random.Random(42)
+        ints = [rand.randrange(-1000, 1000) for _ in range(self.n)]
+        self.check(ints)
+        self.check([str(x) for x in ints])
+        self.check([(float(x), 2 * x) for x in ints], reverse=True)
+
+    def test_stability(self):
+        rand = random.Random(42)
+        data = [(rand.randrange(100), i) for i in range(self.n)]
+        self.check(data, key=lambda x: x[0], reverse=True)
+
+    def test_mixed_tuple_keys(self):
+        # Items after the first one are compared with rich comparisons,
+        # so mixing types at one position must give the sequential result,
+        # including its exceptions.
+        rand = random.Random(42)
+        data = [(rand.randrange(100), i) for i in range(self.n)]
+        mixed = data + [(x, 'a') for x, i in data[:100]]
+        rand.shuffle(mixed)
+        for parallel in (0, 4):
+            with self.subTest(parallel=parallel):
+                self.assertRaises(TypeError, mixed.sort, parallel=parallel)
+
+    def test_bad_argument(self):
+        self.assertRaises(TypeError, [].sort, parallel=1.5)
+        self.assertRaises(TypeError, [].sort, parallel='2')
+
+
 #==============================================================================
 
 if __name__ == "__main__":
@@ -2368,6 +2368,31 @@ def test_concatenation(self):
         self.assertEqual(("abc" "def" "ghi"), "abcdefghi")
         self.assertEqual(("abc" "def" "ghi"), "abcdefghi")
 
+    def test_inplace_concatenation(self):
+        # The left operand may be extended in place when the result is
+        # stored back to the same local; other references must not see it.
+        def concat(n, keep):
+            s = str(n)
+            for i in range(100):
+                if keep:
+                    keep.append(s)
+                s += 'ab'
+                s = s + '\xe9'
+                s += s[-1]
+            return s
+        for keep in [], [None]:
+            s = concat(7, keep)
+            self.assertEqual(s, '7' + 'ab\xe9\xe9' * 100)
+            for i, t in enumerate(keep[1:]):
+                self.assertEqual(t, '7' + 'ab\xe9\xe9' * i)
+
+        def self_concat():
+            s = str(3)
+            for i in range(5):
+                s += s
+            return s
+        self.assertEqual(self_concat(), '3' * 32)
+
     def test_ucs4(self):
         x = '\U00100000'
         y = x.encode("raw-unicode-escape").decode("raw-unicode-escape")
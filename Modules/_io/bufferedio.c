@@ -1110,9 +1110,9 @@ _buffered_readinto_generic(buffered *self, Py_buffer *buffer, char readinto1)
     for (remaining = buffer->len - written;
          remaining > 0;
          written += n, remaining -= n) {
-        /* If remaining bytes is larger than internal buffer size, copy
-         * directly into caller's buffer. */
-        if (remaining > self->buffer_size) {
+        /* If remaining bytes fill the internal buffer, copy directly into
+         * caller's buffer. */
+        if (remaining >= self->buffer_size) {
             n = _bufferedreader_raw_read(self, (char *) buffer->buf + written,
                                          remaining);
         }
@@ -1190,7 +1190,7 @@ _buffered_readline(buffered *self, Py_ssize_t limit)
     PyObject *res = NULL;
     PyObject *chunks = NULL;
     Py_ssize_t n;
-    const char *start, *s, *end;
+    const char *start, *s;
 
     CHECK_CLOSED(self, "readline of closed file")
 
@@ -1218,6 +1218,39 @@ _buffered_readline(buffered *self, Py_ssize_t limit)
     if (!ENTER_BUFFERED(self))
         goto end_unlocked;
 
+    if (!self->writable && n <= self->buffer_size / 2 &&
+        (!VALID_READ_BUFFER(self) || self->raw_pos == self->read_end))
+    {
+        /* Move the start of the line to the beginning of the buffer and
+           read the rest of it after, so that the line is made with a single
+           copy as long as it fits in the buffer. */
+        Py_ssize_t searched = n;
+        memmove(self->buffer, start, n);
+        self->pos = 0;
+        self->read_end = self->raw_pos = n;
+        for (;;) {
+            Py_ssize_t r = _bufferedreader_fill_buffer(self);
+            if (r == -1)
+                goto end;
+            n = Py_SAFE_DOWNCAST(self->read_end, Py_off_t, Py_ssize_t);
+            if (limit >= 0 && n > limit)
+                n = limit;
+            s = memchr(self->buffer + searched, '\n', n - searched);
+            if (s != NULL || r <= 0 || n == limit) {
+                if (s != NULL)
+                    n = s - self->buffer + 1;
+                res = PyBytes_FromStringAndSize(self->buffer, n);
+                if (res != NULL)
+                    self->pos = n;
+                goto end;
+            }
+            if (self->read_end == self->buffer_size)
+                break;
+            searched = n;
+        }
+        start = self->buffer;
+    }
+
     /* Now we try to get some more from the raw stream */
     chunks = PyList_New(0);
     if (chunks == NULL)
@@ -1252,16 +1285,13 @@ _buffered_readline(buffered *self, Py_ssize_t limit)
         if (limit >= 0 && n > limit)
             n = limit;
         start = self->buffer;
-        end = start + n;
-        s = start;
-        while (s < end) {
-            if (*s++ == '\n') {
-                res = PyBytes_FromStringAndSize(start, s - start);
-                if (res == NULL)
-                    goto end;
-                self->pos = s - start;
-                goto found;
-            }
+        s = memchr(start, '\n', n);
+        if (s != NULL) {
+            res = PyBytes_FromStringAndSize(start, s - start + 1);
+            if (res == NULL)
+                goto end;
+            self->pos = s - start + 1;
+            goto found;
         }
         res = PyBytes_FromStringAndSize(start, n);
         if (res == NULL)
@@ -430,6 +430,26 @@ _PyIncrementalNewlineDecoder_decode(PyObject *myself,
             /* We have already seen all newline types, no need to scan again */
             if (seennl == SEEN_ALL)
                 goto endscan;
+            if (kind == PyUnicode_1BYTE_KIND) {
+                /* \r\n is never split between two outputs */
+                const Py_UCS1 *str = in_str, *end = str + len, *p;
+                for (p = str; !(seennl & SEEN_LF) &&
+                              (p = memchr(p, '\n', end - p)) != NULL; p++)
+                {
+                    if (p == str || p[-1] != '\r')
+                        seennl |= SEEN_LF;
+                }
+                for (p = str; (seennl & (SEEN_CR | SEEN_CRLF)) !=
+                                  (SEEN_CR | SEEN_CRLF) &&
+                              (p = memchr(p, '\r', end - p)) != NULL; p++)
+                {
+                    if (p + 1 < end && p[1] == '\n')
+                        seennl |= SEEN_CRLF;
+                    else
+                        seennl |= SEEN_CR;
+                }
+                goto endscan;
+            }
             for (;;) {
                 Py_UCS4 c;
                 /* Fast loop for non-control characters */
@@ -454,6 +474,40 @@ _PyIncrementalNewlineDecoder_decode(PyObject *myself,
         endscan:
             ;
         }
+        else if (kind == PyUnicode_1BYTE_KIND) {
+            /* Copy the runs between \r characters with memcpy() */
+            const Py_UCS1 *in = in_str, *end = in + len;
+            PyObject *translated;
+            Py_UCS1 *out;
+
+            translated = PyUnicode_New(len, PyUnicode_MAX_CHAR_VALUE(output));
+            if (translated == NULL)
+                goto error;
+            out = PyUnicode_1BYTE_DATA(translated);
+            for (;;) {
+                const Py_UCS1 *cr = memchr(in, '\r', end - in);
+                Py_ssize_t n = (cr != NULL ? cr : end) - in;
+                if (!(seennl & SEEN_LF) && memchr(in, '\n', n) != NULL)
+                    seennl |= SEEN_LF;
+                memcpy(out, in, n);
+                out += n;
+                in += n;
+                if (cr == NULL)
+                    break;
+                *out++ = '\n';
+                in++;
+                if (in < end && *in == '\n') {
+                    in++;
+                    seennl |= SEEN_CRLF;
+                }
+                else
+                    seennl |= SEEN_CR;
+            }
+            Py_SETREF(output, translated);
+            if (PyUnicode_Resize(&output,
+                                 out - PyUnicode_1BYTE_DATA(output)) < 0)
+                goto error;
+        }
         else {
             void *translated;
             int kind = PyUnicode_KIND(output);
@@ -2117,6 +2171,25 @@ _PyIO_find_line_ending(
          * The decoder ensures that \r\n are not split in two pieces
          */
         const char *s = start;
+        if (kind == PyUnicode_1BYTE_KIND) {
+            /* Search a window at a time, so that a stream which only uses
+               one kind of newline is not scanned to the end for the other */
+            while (s < end) {
+                const char *e = end - s > 256 ? s + 256 : end;
+                const char *lf = memchr(s, '\n', e - s);
+                const char *cr = memchr(s, '\r', (lf != NULL ? lf : e) - s);
+                if (cr != NULL) {
+                    if (cr + 1 < end && cr[1] == '\n')
+                        return cr - start + 2;
+                    return cr - start + 1;
+                }
+                if (lf != NULL)
+                    return lf - start + 1;
+                s = e;
+            }
+            *consumed = len;
+            return -1;
+        }
         for (;;) {
             Py_UCS4 ch;
             /* Fast path for non-control chars. The loop always ends
@@ -25,8 +25,17 @@ typedef struct _PyScannerObject {
     PyObject *parse_float;
     PyObject *parse_int;
     PyObject *parse_constant;
+    PyObject *memo;
+    Py_ssize_t memo_bytes;  /* approximate size of the keys in memo */
 } PyScannerObject;
 
+/* The scanner keeps the object keys it has seen across calls, so that
+   documents with the same keys share the key strings.  The cache is
+   dropped once it grows past this many entries, or once the keys in it
+   take up more than this many bytes. */
+#define SCANNER_MEMO_MAX_SIZE 4096
+#define SCANNER_MEMO_MAX_BYTES (64 * 1024)
+
 static PyMemberDef scanner_members[] = {
     {"strict", Py_T_BOOL, offsetof(PyScannerObject, strict), Py_READONLY, "strict"},
     {"object_hook", _Py_T_OBJECT, offsetof(PyScannerObject, object_hook), Py_READONLY, "object_hook"},
@@ -353,6 +362,47 @@ _build_rval_index_tuple(PyObject *rval, Py_ssize_t idx) {
     return tpl;
 }
 
+/* Word-at-a-time tests used to skip over plain string content.  They may
+   flag bytes following a match, but never miss one. */
+#define WORD_ONES ((size_t)-1 / 0xFF)
+#define WORD_HIGHS (WORD_ONES * 0x80)
+#define WORD_HAS_LESS(w, n) (((w) - WORD_ONES * (n)) & ~(w) & WORD_HIGHS)
+#define WORD_HAS_BYTE(w, b) WORD_HAS_LESS((w) ^ (WORD_ONES * (b)), 1)
+
+static Py_ssize_t
+find_string_special(int kind, const void *buf, Py_ssize_t start,
+                    Py_ssize_t len, int strict)
+{
+    /* Return the index of the first '"', '\\' or, if strict is nonzero,
+       control character in buf[start:len], or len if there is none. */
+    Py_ssize_t i = start;
+    if (kind == PyUnicode_1BYTE_KIND) {
+        const Py_UCS1 *p = (const Py_UCS1 *)buf;
+        for (; i + (Py_ssize_t)SIZEOF_SIZE_T <= len; i += SIZEOF_SIZE_T) {
+            size_t w;
+            memcpy(&w, p + i, SIZEOF_SIZE_T);
+            if (WORD_HAS_BYTE(w, '"') || WORD_HAS_BYTE(w, '\\') ||
+                (strict && WORD_HAS_LESS(w, 0x20))) {
+                break;
+            }
+        }
+        for (; i < len; i++) {
+            Py_UCS1 c = p[i];
+            if (c == '"' || c == '\\' || (c <= 0x1f && strict)) {
+                break;
+            }
+        }
+        return i;
+    }
+    for (; i < len; i++) {
+        Py_UCS4 c = PyUnicode_READ(kind, buf, i);
+        if (c == '"' || c == '\\' || (c <= 0x1f && strict)) {
+            break;
+        }
+    }
+    return i;
+}
+
 static PyObject *
 scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next_end_ptr)
 {
@@ -385,21 +435,14 @@ scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next
     }
     while (1) {
         /* Find the end of the string or the next escape */
-        Py_UCS4 c;
-        {
-            // Use tight scope variable to help register allocation.
-            Py_UCS4 d = 0;
-            for (next = end; next < len; next++) {
-                d = PyUnicode_READ(kind, buf, next);
-                if (d == '"' || d == '\\') {
-                    break;
-                }
-                if (d <= 0x1f && strict) {
-                    raise_errmsg("Invalid control character at", pystr, next);
-                    goto bail;
-                }
+        Py_UCS4 c = 0;
+        next = find_string_special(kind, buf, end, len, strict);
+        if (next < len) {
+            c = PyUnicode_READ(kind, buf, next);
+            if (c != '"' && c != '\\') {
+                raise_errmsg("Invalid control character at", pystr, next);
+                goto bail;
             }
-            c = d;
         }
 
         if (c == '"') {
@@ -631,6 +674,7 @@ scanner_traverse(PyScannerObject *self, visitproc visit, void *arg)
     Py_VISIT(self->parse_float);
     Py_VISIT(self->parse_int);
     Py_VISIT(self->parse_constant);
+    Py_VISIT(self->memo);
     return 0;
 }
 
@@ -642,6 +686,7 @@ scanner_clear(PyScannerObject *self)
     Py_CLEAR(self->parse_float);
     Py_CLEAR(self->parse_int);
     Py_CLEAR(self->parse_constant);
+    Py_CLEAR(self->memo);
     return 0;
 }
 
@@ -692,9 +737,14 @@ _parse_object_unicode(PyScannerObject *s, PyObject *memo, PyObject *pystr, Py_ss
             key = scanstring_unicode(pystr, idx + 1, s->strict, &next_idx);
             if (key == NULL)
                 goto bail;
-            if (PyDict_SetDefaultRef(memo, key, key, &memokey) < 0) {
+            int found = PyDict_SetDefaultRef(memo, key, key, &memokey);
+            if (found < 0) {
                 goto bail;
             }
+            if (!found) {
+                _Py_atomic_add_ssize(&s->memo_bytes,
+                    PyUnicode_GET_LENGTH(key) * PyUnicode_KIND(key));
+            }
             Py_SETREF(key, memokey);
             idx = next_idx;
 
@@ -1124,12 +1174,16 @@ scanner_call(PyScannerObject *self, PyObject *args, PyObject *kwds)
         return NULL;
     }
 
-    PyObject *memo = PyDict_New();
-    if (memo == NULL) {
-        return NULL;
+    rval = scan_once_unicode(self, self->memo, pystr, idx, &next_idx);
+    /* Only the thread that resets memo_bytes clears the memo.  Keys added
+       concurrently make the reset fail, so memo_bytes never undercounts. */
+    Py_ssize_t bytes = _Py_atomic_load_ssize_relaxed(&self->memo_bytes);
+    if ((PyDict_GET_SIZE(self->memo) > SCANNER_MEMO_MAX_SIZE ||
+         bytes > SCANNER_MEMO_MAX_BYTES) &&
+        _Py_atomic_compare_exchange_ssize(&self->memo_bytes, &bytes, 0))
+    {
+        PyDict_Clear(self->memo);
     }
-    rval = scan_once_unicode(self, memo, pystr, idx, &next_idx);
-    Py_DECREF(memo);
     if (rval == NULL)
         return NULL;
     return _build_rval_index_tuple(rval, next_idx);
@@ -1174,6 +1228,10 @@ scanner_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     s->parse_constant = PyObject_GetAttrString(ctx, "parse_constant");
     if (s->parse_constant == NULL)
         goto bail;
+    s->memo = PyDict_New();
+    if (s->memo == NULL)
+        goto bail;
+    s->memo_bytes = 0;
 
     return (PyObject *)s;
 
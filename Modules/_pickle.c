@@ -171,6 +171,10 @@ typedef struct {
 
     /* copyreg.dispatch_table, {type_object: pickling_function} */
     PyObject *dispatch_table;
+    /* copyreg.__newobj__ and copyreg.__newobj_ex__, returned by
+       object.__reduce_ex__() */
+    PyObject *newobj;
+    PyObject *newobj_ex;
 
     /* For the extension opcodes EXT1, EXT2 and EXT4. */
 
@@ -244,6 +248,8 @@ _Pickle_ClearState(PickleState *st)
     Py_CLEAR(st->PicklingError);
     Py_CLEAR(st->UnpicklingError);
     Py_CLEAR(st->dispatch_table);
+    Py_CLEAR(st->newobj);
+    Py_CLEAR(st->newobj_ex);
     Py_CLEAR(st->extension_registry);
     Py_CLEAR(st->extension_cache);
     Py_CLEAR(st->inverted_registry);
@@ -284,6 +290,12 @@ _Pickle_InitState(PickleState *st)
                      Py_TYPE(st->dispatch_table)->tp_name);
         goto error;
     }
+    st->newobj = PyObject_GetAttrString(copyreg, "__newobj__");
+    if (!st->newobj)
+        goto error;
+    st->newobj_ex = PyObject_GetAttrString(copyreg, "__newobj_ex__");
+    if (!st->newobj_ex)
+        goto error;
     st->extension_registry = \
         PyObject_GetAttrString(copyreg, "_extension_registry");
     if (!st->extension_registry)
@@ -1663,6 +1675,78 @@ _Unpickler_SetInputStream(UnpicklerObject *self, PyObject *file)
     return -1;
 }
 
+/* If the file object exposes its content through the buffer protocol and
+   can report and set its position, as mmap objects do, unpickle directly
+   from that memory starting at the current position instead of copying
+   it through read().  Returns 1 if the file was set up as input, 0 if it
+   doesn't qualify, and -1 (with an exception set) on failure. */
+static int
+_Unpickler_SetMappedInput(UnpicklerObject *self, PyObject *file)
+{
+    PyObject *tell, *pos_obj;
+    Py_ssize_t pos;
+    int has_seek;
+
+    if (!PyObject_CheckBuffer(file)) {
+        return 0;
+    }
+    has_seek = PyObject_HasAttrWithError(file, &_Py_ID(seek));
+    if (has_seek <= 0) {
+        return has_seek;
+    }
+    if (PyObject_GetOptionalAttr(file, &_Py_ID(tell), &tell) <= 0) {
+        return PyErr_Occurred() ? -1 : 0;
+    }
+    pos_obj = PyObject_CallNoArgs(tell);
+    Py_DECREF(tell);
+    if (pos_obj == NULL) {
+        return -1;
+    }
+    pos = PyLong_AsSsize_t(pos_obj);
+    Py_DECREF(pos_obj);
+    if (pos == -1 && PyErr_Occurred()) {
+        return -1;
+    }
+    if (_Unpickler_SetStringInput(self, file) < 0) {
+        return -1;
+    }
+    if (pos < 0 || pos > self->input_len) {
+        PyErr_SetString(PyExc_ValueError, "file position out of range");
+        return -1;
+    }
+    self->next_read_idx = pos;
+    return 1;
+}
+
+/* Release the memory set up by _Unpickler_SetMappedInput(), so that the
+   file can be closed or resized again.  If seek is true, also move the file
+   position past the data that was unpickled. */
+static int
+_Unpickler_ReleaseMappedInput(UnpicklerObject *self, PyObject *file, int seek)
+{
+    PyObject *pos, *res;
+
+    pos = PyLong_FromSsize_t(self->next_read_idx);
+    PyBuffer_Release(&self->buffer);
+    self->buffer.buf = NULL;
+    self->input_buffer = NULL;
+    self->input_len = self->next_read_idx = self->prefetched_idx = 0;
+    if (pos == NULL) {
+        return -1;
+    }
+    if (!seek) {
+        Py_DECREF(pos);
+        return 0;
+    }
+    res = PyObject_CallMethodOneArg(file, &_Py_ID(seek), pos);
+    Py_DECREF(pos);
+    if (res == NULL) {
+        return -1;
+    }
+    Py_DECREF(res);
+    return 0;
+}
+
 /* Returns -1 (with an exception set) on failure, 0 on success. This may
    be called once on a freshly created Unpickler. */
 static int
@@ -1749,9 +1833,10 @@ memo_get(PickleState *st, PicklerObject *self, PyObject *key)
 }
 
 /* Store an object in the memo, assign it a new unique ID based on the number
-   of objects currently stored in the memo and generate a PUT opcode. */
+   of objects currently stored in the memo and generate a PUT opcode.
+   Unlike memo_put(), this is done in fast mode too. */
 static int
-memo_put(PickleState *st, PicklerObject *self, PyObject *obj)
+memo_put_always(PickleState *st, PicklerObject *self, PyObject *obj)
 {
     char pdata[30];
     Py_ssize_t len;
@@ -1759,9 +1844,6 @@ memo_put(PickleState *st, PicklerObject *self, PyObject *obj)
 
     const char memoize_op = MEMOIZE;
 
-    if (self->fast)
-        return 0;
-
     idx = PyMemoTable_Size(self->memo);
     if (PyMemoTable_Set(self->memo, obj, idx) < 0)
         return -1;
@@ -1803,6 +1885,14 @@ memo_put(PickleState *st, PicklerObject *self, PyObject *obj)
     return 0;
 }
 
+static int
+memo_put(PickleState *st, PicklerObject *self, PyObject *obj)
+{
+    if (self->fast)
+        return 0;
+    return memo_put_always(st, self, obj);
+}
+
 static PyObject *
 get_dotted_path(PyObject *name)
 {
@@ -2751,6 +2841,98 @@ save_unicode(PickleState *state, PicklerObject *self, PyObject *obj)
     return 0;
 }
 
+/* Number of atoms encoded into a single write by save_atoms(). */
+#define ATOMS_CHUNK 64
+
+/* Pickle the leading run of items that are atoms with a fixed-size binary
+ * encoding (None, bools, floats and ints that fit in 4 bytes) directly,
+ * without going through save() for each of them, and a chunk of items at a
+ * time.  Returns the number of items written, or -1 on error.
+ *
+ * Writing a chunk may commit a frame and so run Python code.  items must
+ * therefore stay valid across writes, which only holds for immutable
+ * containers; for a list, pass at most ATOMS_CHUNK items and fetch the
+ * items again after each call.
+ */
+static Py_ssize_t
+save_atoms(PicklerObject *self, PyObject *const *items, Py_ssize_t n)
+{
+    char buf[ATOMS_CHUNK * 9];
+    Py_ssize_t done = 0;
+
+    if (self->proto < 2 || self->persistent_id != NULL) {
+        return 0;
+    }
+    while (done < n) {
+        Py_ssize_t end = Py_MIN(n, done + ATOMS_CHUNK);
+        Py_ssize_t i, len = 0;
+
+        for (i = done; i < end; i++) {
+            PyObject *item = items[i];
+            char *p = buf + len;
+
+            if (item == Py_None) {
+                p[0] = NONE;
+                len += 1;
+            }
+            else if (item == Py_True || item == Py_False) {
+                p[0] = (item == Py_True) ? NEWTRUE : NEWFALSE;
+                len += 1;
+            }
+            else if (PyFloat_CheckExact(item)) {
+                p[0] = BINFLOAT;
+                if (PyFloat_Pack8(PyFloat_AS_DOUBLE(item), &p[1], 0) < 0) {
+                    return -1;
+                }
+                len += 9;
+            }
+            else if (PyLong_CheckExact(item) &&
+                     _PyLong_IsCompact((PyLongObject *)item))
+            {
+                /* Same encoding as save_long(). */
+                Py_ssize_t val = _PyLong_CompactValue((PyLongObject *)item);
+                if (val > 0x7fffffffL || val < (-0x7fffffffL - 1)) {
+                    break;
+                }
+                if (val < 0 || val > 0xffff) {
+                    p[0] = BININT;
+                    p[1] = (unsigned char)(val & 0xff);
+                    p[2] = (unsigned char)((val >> 8) & 0xff);
+                    p[3] = (unsigned char)((val >> 16) & 0xff);
+                    p[4] = (unsigned char)((val >> 24) & 0xff);
+                    len += 5;
+                }
+                else if (val > 0xff) {
+                    p[0] = BININT2;
+                    p[1] = (unsigned char)(val & 0xff);
+                    p[2] = (unsigned char)((val >> 8) & 0xff);
+                    len += 3;
+                }
+                else {
+                    p[0] = BININT1;
+                    p[1] = (unsigned char)val;
+                    len += 2;
+                }
+            }
+            else {
+                break;
+            }
+        }
+        if (len > 0) {
+            if (_Pickler_OpcodeBoundary(self) < 0 ||
+                _Pickler_Write(self, buf, len) < 0)
+            {
+                return -1;
+            }
+        }
+        done = i;
+        if (i < end) {
+            break;
+        }
+    }
+    return done;
+}
+
 /* A helper for save_tuple.  Push the len elements in tuple t on the stack. */
 static int
 store_tuple_elements(PickleState *state, PicklerObject *self, PyObject *t,
@@ -2760,7 +2942,11 @@ store_tuple_elements(PickleState *state, PicklerObject *self, PyObject *t,
 
     assert(PyTuple_Size(t) == len);
 
-    for (i = 0; i < len; i++) {
+    i = save_atoms(self, &PyTuple_GET_ITEM(t, 0), len);
+    if (i < 0) {
+        return -1;
+    }
+    for (; i < len; i++) {
         PyObject *element = PyTuple_GET_ITEM(t, i);
 
         if (element == NULL)
@@ -3048,6 +3234,22 @@ batch_list_exact(PickleState *state, PicklerObject *self, PyObject *obj)
         if (_Pickler_Write(self, &mark_op, 1) < 0)
             return -1;
         while (total < PyList_GET_SIZE(obj)) {
+            Py_ssize_t n = PyList_GET_SIZE(obj) - total;
+            n = Py_MIN(n, Py_MIN(BATCHSIZE - this_batch, ATOMS_CHUNK));
+            n = save_atoms(self, &PyList_GET_ITEM(obj, total), n);
+            if (n < 0) {
+                return -1;
+            }
+            if (n > 0) {
+                total += n;
+                this_batch += n;
+                if (this_batch == BATCHSIZE) {
+                    break;
+                }
+                /* The write may have run Python code that mutated the
+                   list, so check its size again. */
+                continue;
+            }
             item = PyList_GET_ITEM(obj, total);
             Py_INCREF(item);
             int err = save(state, self, item, 0);
@@ -3854,8 +4056,10 @@ save_global(PickleState *st, PicklerObject *self, PyObject *obj,
                 }
             }
         }
-        /* Memoize the object. */
-        if (memo_put(st, self, obj) < 0)
+        /* Memoize the object.  Globals are memoized even in fast mode: they
+           cannot be part of a cycle, and all instances of a class refer to
+           the same one. */
+        if (memo_put_always(st, self, obj) < 0)
             goto error;
     }
 
@@ -4046,7 +4250,13 @@ save_reduce(PickleState *st, PicklerObject *self, PyObject *args,
         return -1;
     }
 
-    if (self->proto >= 2) {
+    if (self->proto >= 2 && callable == st->newobj) {
+        use_newobj = 1;
+    }
+    else if (self->proto >= 2 && callable == st->newobj_ex) {
+        use_newobj_ex = 1;
+    }
+    else if (self->proto >= 2) {
         PyObject *name;
 
         if (PyObject_GetOptionalAttr(callable, &_Py_ID(__name__), &name) < 0) {
@@ -4485,15 +4695,29 @@ save(PickleState *st, PicklerObject *self, PyObject *obj, int pers_save)
            wrong. Incidentally, this means if __reduce_ex__ is not defined, we
            don't actually have to check for a __reduce__ method. */
 
-        /* Check for a __reduce_ex__ method. */
-        if (PyObject_GetOptionalAttr(obj, &_Py_ID(__reduce_ex__), &reduce_func) < 0) {
-            goto error;
+        /* Check for a __reduce_ex__ method.  Look it up without creating
+           a bound method, which would be thrown away right after the call. */
+        int unbound = _PyObject_GetMethod(obj, &_Py_ID(__reduce_ex__),
+                                          &reduce_func);
+        if (reduce_func == NULL) {
+            if (!PyErr_ExceptionMatches(PyExc_AttributeError)) {
+                goto error;
+            }
+            PyErr_Clear();
         }
         if (reduce_func != NULL) {
             PyObject *proto;
             proto = PyLong_FromLong(self->proto);
             if (proto != NULL) {
-                reduce_value = _Pickle_FastCall(reduce_func, proto);
+                if (unbound) {
+                    PyObject *args[2] = {obj, proto};
+                    reduce_value = PyObject_Vectorcall(reduce_func, args,
+                                                       2, NULL);
+                    Py_DECREF(proto);
+                }
+                else {
+                    reduce_value = _Pickle_FastCall(reduce_func, proto);
+                }
             }
         }
         else {
@@ -4602,6 +4826,12 @@ dump(PickleState *state, PicklerObject *self, PyObject *obj)
   error:
     self->framing = 0;
 
+    /* Only globals are memoized in fast mode, and a fast pickle must not
+       refer to them from the previous dump(). */
+    if (self->fast) {
+        PyMemoTable_Clear(self->memo);
+    }
+
     /* Break the reference cycle we generated at the beginning this function
      * call when setting the persistent_id and the reducer_override attributes
      * of the Pickler instance to a bound method of the same instance.
@@ -7768,12 +7998,16 @@ _pickle_load_impl(PyObject *module, PyObject *file, int fix_imports,
 /*[clinic end generated code: output=250452d141c23e76 input=46c7c31c92f4f371]*/
 {
     PyObject *result;
+    int mapped;
     UnpicklerObject *unpickler = _Unpickler_New(module);
 
     if (unpickler == NULL)
         return NULL;
 
-    if (_Unpickler_SetInputStream(unpickler, file) < 0)
+    mapped = _Unpickler_SetMappedInput(unpickler, file);
+    if (mapped < 0)
+        goto error;
+    if (!mapped && _Unpickler_SetInputStream(unpickler, file) < 0)
         goto error;
 
     if (_Unpickler_SetInputEncoding(unpickler, encoding, errors) < 0)
@@ -7786,6 +8020,11 @@ _pickle_load_impl(PyObject *module, PyObject *file, int fix_imports,
 
     PickleState *state = _Pickle_GetState(module);
     result = load(state, unpickler);
+    if (mapped &&
+        _Unpickler_ReleaseMappedInput(unpickler, file, result != NULL) < 0)
+    {
+        Py_CLEAR(result);
+    }
     Py_DECREF(unpickler);
     return result;
 
@@ -7884,6 +8123,8 @@ pickle_traverse(PyObject *m, visitproc visit, void *arg)
     Py_VISIT(st->PicklingError);
     Py_VISIT(st->UnpicklingError);
     Py_VISIT(st->dispatch_table);
+    Py_VISIT(st->newobj);
+    Py_VISIT(st->newobj_ex);
     Py_VISIT(st->extension_registry);
     Py_VISIT(st->extension_cache);
     Py_VISIT(st->inverted_registry);
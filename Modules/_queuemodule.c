@@ -38,7 +38,8 @@ typedef struct {
 
     PyObject **items;
 
-    // Total number of items that may be stored
+    // Total number of items that may be stored. Always a power of two, so
+    // that indices can be wrapped with a mask rather than a division.
     Py_ssize_t items_cap;
 
     // Number of items stored
@@ -64,7 +65,7 @@ static PyObject *
 RingBuf_At(RingBuf *buf, Py_ssize_t idx)
 {
     assert(idx >= 0 && idx < buf->num_items);
-    return buf->items[(buf->get_idx + idx) % buf->items_cap];
+    return buf->items[(buf->get_idx + idx) & (buf->items_cap - 1)];
 }
 
 static void
@@ -79,7 +80,7 @@ RingBuf_Fini(RingBuf *buf)
     buf->get_idx = 0;
     buf->num_items = 0;
     buf->items_cap = 0;
-    for (Py_ssize_t n = num_items; n > 0; idx = (idx + 1) % cap, n--) {
+    for (Py_ssize_t n = num_items; n > 0; idx = (idx + 1) & (cap - 1), n--) {
         Py_DECREF(items[idx]);
     }
     PyMem_Free(items);
@@ -97,6 +98,7 @@ resize_ringbuf(RingBuf *buf, Py_ssize_t capacity)
         return 0;
     }
     assert(buf->num_items <= new_capacity);
+    assert((new_capacity & (new_capacity - 1)) == 0);
 
     PyObject **new_items = PyMem_Calloc(new_capacity, sizeof(PyObject *));
     if (new_items == NULL) {
@@ -147,7 +149,7 @@ RingBuf_Get(RingBuf *buf)
 
     PyObject *item = buf->items[buf->get_idx];
     buf->items[buf->get_idx] = NULL;
-    buf->get_idx = (buf->get_idx + 1) % buf->items_cap;
+    buf->get_idx = (buf->get_idx + 1) & (buf->items_cap - 1);
     buf->num_items--;
     return item;
 }
@@ -168,7 +170,7 @@ RingBuf_Put(RingBuf *buf, PyObject *item)
         }
     }
     buf->items[buf->put_idx] = item;
-    buf->put_idx = (buf->put_idx + 1) % buf->items_cap;
+    buf->put_idx = (buf->put_idx + 1) & (buf->items_cap - 1);
     buf->num_items++;
     return 0;
 }
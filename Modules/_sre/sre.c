@@ -238,10 +238,10 @@ char_loc_ignore(SRE_CODE pattern, SRE_CODE ch)
 static void
 data_stack_dealloc(SRE_STATE* state)
 {
-    if (state->data_stack) {
+    if (state->data_stack != state->small_data_stack.data) {
         PyMem_Free(state->data_stack);
-        state->data_stack = NULL;
     }
+    state->data_stack = NULL;
     state->data_stack_size = state->data_stack_base = 0;
 }
 
@@ -254,9 +254,24 @@ data_stack_grow(SRE_STATE* state, Py_ssize_t size)
     cursize = state->data_stack_size;
     if (cursize < minsize) {
         void* stack;
+        if (state->data_stack == NULL &&
+            minsize <= SRE_SMALL_DATA_STACK_SIZE)
+        {
+            state->data_stack = state->small_data_stack.data;
+            state->data_stack_size = SRE_SMALL_DATA_STACK_SIZE;
+            return 0;
+        }
         cursize = minsize+minsize/4+1024;
         TRACE(("allocate/grow stack %zd\n", cursize));
-        stack = PyMem_Realloc(state->data_stack, cursize);
+        if (state->data_stack == state->small_data_stack.data) {
+            stack = PyMem_Malloc(cursize);
+            if (stack) {
+                memcpy(stack, state->data_stack, state->data_stack_base);
+            }
+        }
+        else {
+            stack = PyMem_Realloc(state->data_stack, cursize);
+        }
         if (!stack) {
             data_stack_dealloc(state);
             return SRE_ERROR_MEMORY;
@@ -408,7 +423,8 @@ state_reset(SRE_STATE* state)
 
     state->repeat = NULL;
 
-    data_stack_dealloc(state);
+    /* Keep the data stack for the next search. */
+    state->data_stack_base = 0;
 }
 
 static const void*
@@ -459,12 +475,17 @@ state_init(SRE_STATE* state, PatternObject* pattern, PyObject* string,
     int isbytes, charsize;
     const void* ptr;
 
-    memset(state, 0, sizeof(SRE_STATE));
+    memset(state, 0, offsetof(SRE_STATE, small_mark));
 
-    state->mark = PyMem_New(const void *, pattern->groups * 2);
-    if (!state->mark) {
-        PyErr_NoMemory();
-        goto err;
+    if (pattern->groups * 2 <= SRE_SMALL_MARK_SIZE) {
+        state->mark = state->small_mark;
+    }
+    else {
+        state->mark = PyMem_New(const void *, pattern->groups * 2);
+        if (!state->mark) {
+            PyErr_NoMemory();
+            goto err;
+        }
     }
     state->lastmark = -1;
     state->lastindex = -1;
@@ -516,7 +537,9 @@ state_init(SRE_STATE* state, PatternObject* pattern, PyObject* string,
     /* We add an explicit cast here because MSVC has a bug when
        compiling C code where it believes that `const void**` cannot be
        safely casted to `void*`, see bpo-39943 for details. */
-    PyMem_Free((void*) state->mark);
+    if (state->mark != state->small_mark) {
+        PyMem_Free((void*) state->mark);
+    }
     state->mark = NULL;
     if (state->buffer.buf)
         PyBuffer_Release(&state->buffer);
@@ -530,8 +553,10 @@ state_fini(SRE_STATE* state)
         PyBuffer_Release(&state->buffer);
     Py_XDECREF(state->string);
     data_stack_dealloc(state);
-    /* See above PyMem_Free() for why we explicitly cast here. */
-    PyMem_Free((void*) state->mark);
+    if (state->mark != state->small_mark) {
+        /* See above PyMem_Free() for why we explicitly cast here. */
+        PyMem_Free((void*) state->mark);
+    }
     state->mark = NULL;
 }
 
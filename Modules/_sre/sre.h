@@ -70,6 +70,11 @@ typedef struct SRE_REPEAT_T {
     struct SRE_REPEAT_T *prev; /* points to previous repeat context */
 } SRE_REPEAT;
 
+/* Matches which need no more marks and data stack than this use the
+   storage inside SRE_STATE instead of allocating memory. */
+#define SRE_SMALL_MARK_SIZE 20
+#define SRE_SMALL_DATA_STACK_SIZE 1024
+
 typedef struct {
     /* string pointers */
     const void* ptr; /* current position (also end of current slice) */
@@ -96,6 +101,12 @@ typedef struct {
     /* current repeat context */
     SRE_REPEAT *repeat;
     unsigned int sigcount;
+    /* preallocated stuff; not cleared by state_init() */
+    const void* small_mark[SRE_SMALL_MARK_SIZE];
+    union {
+        char data[SRE_SMALL_DATA_STACK_SIZE];
+        void* align;
+    } small_data_stack;
 } SRE_STATE;
 
 typedef struct {
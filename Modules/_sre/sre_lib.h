@@ -1735,10 +1735,16 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
         end = (SRE_CHAR *)state->end;
         state->must_advance = 0;
         while (ptr < end) {
+#if SIZEOF_SRE_CHAR == 1
+            ptr = memchr(ptr, c, end - ptr);
+            if (ptr == NULL)
+                return 0;
+#else
             while (*ptr != c) {
                 if (++ptr >= end)
                     return 0;
             }
+#endif
             TRACE(("|%p|%p|SEARCH LITERAL\n", pattern, ptr));
             state->start = ptr;
             state->ptr = ptr + prefix_skip;
@@ -1768,10 +1774,17 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
 #endif
         while (ptr < end) {
             SRE_CHAR c = (SRE_CHAR) prefix[0];
+#if SIZEOF_SRE_CHAR == 1
+            ptr = memchr(ptr, c, end - ptr);
+            if (ptr == NULL)
+                return 0;
+            ptr++;
+#else
             while (*ptr++ != c) {
                 if (ptr >= end)
                     return 0;
             }
+#endif
             if (ptr >= end)
                 return 0;
 
@@ -1806,11 +1819,38 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
 
     if (charset) {
         /* pattern starts with a character from a known set */
+        /* Once no candidate was found for a while, tabulate the set for
+           the first 256 characters.  Filling the table costs about as much
+           as the scan so far. */
+        unsigned char table[256];
+        int has_table = 0;
         end = (SRE_CHAR *)state->end;
         state->must_advance = 0;
         for (;;) {
-            while (ptr < end && !SRE(charset)(state, charset, *ptr))
-                ptr++;
+            if (has_table) {
+#if SIZEOF_SRE_CHAR == 1
+                while (ptr < end && !table[*ptr])
+                    ptr++;
+#else
+                while (ptr < end &&
+                       !(*ptr < 256 ? table[*ptr]
+                                    : SRE(charset)(state, charset, *ptr)))
+                    ptr++;
+#endif
+            }
+            else {
+                SRE_CHAR *limit = end - ptr > 256 ? ptr + 256 : end;
+                while (ptr < limit && !SRE(charset)(state, charset, *ptr))
+                    ptr++;
+                if (ptr == limit && limit != end) {
+                    for (int i = 0; i < 256; i++) {
+                        table[i] = (unsigned char)SRE(charset)(state,
+                                                               charset, i);
+                    }
+                    has_table = 1;
+                    continue;
+                }
+            }
             if (ptr >= end)
                 return 0;
             TRACE(("|%p|%p|SEARCH CHARSET\n", pattern, ptr));
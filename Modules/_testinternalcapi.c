@@ -1963,6 +1963,15 @@ get_py_thread_id(PyObject *self, PyObject *Py_UNUSED(ignored))
     Py_BUILD_ASSERT(sizeof(unsigned long long) >= sizeof(tid));
     return PyLong_FromUnsignedLongLong(tid);
 }
+
+static PyObject *
+can_incref_shared(PyObject *self, PyObject *obj)
+{
+    /* Can a thread other than the owner incref obj without locking?
+       See _Py_TryIncRefShared(). */
+    Py_ssize_t shared = _Py_atomic_load_ssize_relaxed(&obj->ob_ref_shared);
+    return PyBool_FromLong(shared != 0 && shared != _Py_REF_MERGED);
+}
 #endif
 
 static PyObject *
@@ -2110,6 +2119,7 @@ static PyMethodDef module_functions[] = {
 
 #ifdef Py_GIL_DISABLED
     {"py_thread_id", get_py_thread_id, METH_NOARGS},
+    {"can_incref_shared", can_incref_shared, METH_O},
 #endif
 #ifdef _Py_TIER2
     {"uop_symbols_test", _Py_uop_symbols_test, METH_NOARGS},
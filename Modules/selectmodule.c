@@ -1547,34 +1547,15 @@ select_epoll_unregister_impl(pyEpoll_Object *self, int fd)
     return pyepoll_internal_ctl(self->epfd, EPOLL_CTL_DEL, fd, 0);
 }
 
-/*[clinic input]
-select.epoll.poll
-
-    timeout as timeout_obj: object = None
-      the maximum time to wait in seconds (as float);
-      a timeout of None or -1 makes poll wait indefinitely
-    maxevents: int = -1
-      the maximum number of events returned; -1 means no limit
-
-Wait for events on the epoll file descriptor.
-
-Returns a list containing any descriptors that have events to report,
-as a list of (fd, events) 2-tuples.
-[clinic start generated code]*/
-
-static PyObject *
-select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
-                       int maxevents)
-/*[clinic end generated code: output=e02d121a20246c6c input=33d34a5ea430fd5b]*/
+/* Wait for events on the epoll object, retrying on EINTR.  Returns the
+   number of events stored in evs, or -1 with an exception set. */
+static int
+pyepoll_wait(pyEpoll_Object *self, PyObject *timeout_obj,
+             struct epoll_event *evs, int maxevents)
 {
-    int nfds, i;
-    PyObject *elist = NULL, *etuple = NULL;
-    struct epoll_event *evs = NULL;
+    int nfds;
     PyTime_t timeout = -1, ms = -1, deadline = 0;
 
-    if (self->epfd < 0)
-        return pyepoll_err_closed();
-
     if (timeout_obj != Py_None) {
         /* epoll_wait() has a resolution of 1 millisecond, round towards
            infinity to wait at least timeout seconds. */
@@ -1584,13 +1565,13 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
                 PyErr_SetString(PyExc_TypeError,
                                 "timeout must be an integer or None");
             }
-            return NULL;
+            return -1;
         }
 
         ms = _PyTime_AsMilliseconds(timeout, _PyTime_ROUND_CEILING);
         if (ms < INT_MIN || ms > INT_MAX) {
             PyErr_SetString(PyExc_OverflowError, "timeout is too large");
-            return NULL;
+            return -1;
         }
         /* epoll_wait(2) treats all arbitrary negative numbers the same
            for the timeout argument, but -1 is the documented way to block
@@ -1608,22 +1589,6 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
         }
     }
 
-    if (maxevents == -1) {
-        maxevents = FD_SETSIZE-1;
-    }
-    else if (maxevents < 1) {
-        PyErr_Format(PyExc_ValueError,
-                     "maxevents must be greater than 0, got %d",
-                     maxevents);
-        return NULL;
-    }
-
-    evs = PyMem_New(struct epoll_event, maxevents);
-    if (evs == NULL) {
-        PyErr_NoMemory();
-        return NULL;
-    }
-
     do {
         Py_BEGIN_ALLOW_THREADS
         errno = 0;
@@ -1635,7 +1600,7 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
 
         /* poll() was interrupted by a signal */
         if (PyErr_CheckSignals())
-            goto error;
+            return -1;
 
         if (timeout >= 0) {
             timeout = _PyDeadline_Get(deadline);
@@ -1650,6 +1615,56 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
 
     if (nfds < 0) {
         PyErr_SetFromErrno(PyExc_OSError);
+        return -1;
+    }
+    return nfds;
+}
+
+/*[clinic input]
+select.epoll.poll
+
+    timeout as timeout_obj: object = None
+      the maximum time to wait in seconds (as float);
+      a timeout of None or -1 makes poll wait indefinitely
+    maxevents: int = -1
+      the maximum number of events returned; -1 means no limit
+
+Wait for events on the epoll file descriptor.
+
+Returns a list containing any descriptors that have events to report,
+as a list of (fd, events) 2-tuples.
+[clinic start generated code]*/
+
+static PyObject *
+select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
+                       int maxevents)
+/*[clinic end generated code: output=e02d121a20246c6c input=33d34a5ea430fd5b]*/
+{
+    int nfds, i;
+    PyObject *elist = NULL, *etuple = NULL;
+    struct epoll_event *evs = NULL;
+
+    if (self->epfd < 0)
+        return pyepoll_err_closed();
+
+    if (maxevents == -1) {
+        maxevents = FD_SETSIZE-1;
+    }
+    else if (maxevents < 1) {
+        PyErr_Format(PyExc_ValueError,
+                     "maxevents must be greater than 0, got %d",
+                     maxevents);
+        return NULL;
+    }
+
+    evs = PyMem_New(struct epoll_event, maxevents);
+    if (evs == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+
+    nfds = pyepoll_wait(self, timeout_obj, evs, maxevents);
+    if (nfds < 0) {
         goto error;
     }
 
@@ -1672,6 +1687,68 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
     return elist;
 }
 
+/*[clinic input]
+select.epoll.poll_into
+
+    buffer: Py_buffer(accept={rwbuffer})
+      a writable buffer of unsigned 64-bit integers, such as array('Q')
+    timeout as timeout_obj: object = None
+      the maximum time to wait in seconds (as float);
+      a timeout of None or -1 makes poll wait indefinitely
+
+Wait for events on the epoll file descriptor, storing them into a buffer.
+
+Each event is stored as two consecutive items of the buffer, the file
+descriptor followed by the event mask, so at most len(buffer) // 2
+events are returned.  Returns the number of events stored.
+[clinic start generated code]*/
+
+static PyObject *
+select_epoll_poll_into_impl(pyEpoll_Object *self, Py_buffer *buffer,
+                            PyObject *timeout_obj)
+/*[clinic end generated code: output=7c6be9e9d75f39d0 input=ed4bfe09c2e517e8]*/
+{
+    int nfds, i;
+    Py_ssize_t maxevents;
+    struct epoll_event ev;
+    char *buf = buffer->buf;
+
+    if (self->epfd < 0)
+        return pyepoll_err_closed();
+
+    maxevents = buffer->len / (2 * sizeof(uint64_t));
+    if (maxevents < 1) {
+        PyErr_SetString(PyExc_ValueError,
+                        "buffer is too small to hold an event");
+        return NULL;
+    }
+    if (maxevents > INT_MAX) {
+        maxevents = INT_MAX;
+    }
+
+    /* struct epoll_event is never larger than the two items an event
+       occupies in the buffer, so epoll_wait() can store the events at the
+       start of the buffer.  They are then expanded in place, starting
+       from the last one so that no event is overwritten before it has
+       been read. */
+    Py_BUILD_ASSERT(sizeof(struct epoll_event) <= 2 * sizeof(uint64_t));
+    nfds = pyepoll_wait(self, timeout_obj, (struct epoll_event *)buf,
+                        (int)maxevents);
+    if (nfds < 0) {
+        return NULL;
+    }
+
+    for (i = nfds - 1; i >= 0; i--) {
+        uint64_t item[2];
+
+        memcpy(&ev, buf + (size_t)i * sizeof(struct epoll_event), sizeof(ev));
+        item[0] = (uint64_t)ev.data.fd;
+        item[1] = ev.events;
+        memcpy(buf + (size_t)i * sizeof(item), item, sizeof(item));
+    }
+    return PyLong_FromLong(nfds);
+}
+
 
 /*[clinic input]
 select.epoll.__enter__
@@ -2477,6 +2554,7 @@ static PyMethodDef pyepoll_methods[] = {
     SELECT_EPOLL_REGISTER_METHODDEF
     SELECT_EPOLL_UNREGISTER_METHODDEF
     SELECT_EPOLL_POLL_METHODDEF
+    SELECT_EPOLL_POLL_INTO_METHODDEF
     SELECT_EPOLL___ENTER___METHODDEF
     SELECT_EPOLL___EXIT___METHODDEF
     {NULL,      NULL},
@@ -4866,6 +4866,283 @@ the message.  The return value is the number of bytes of non-ancillary\n\
 data sent.");
 #endif    /* CMSG_LEN */
 
+#ifdef HAVE_RECVMMSG
+struct sock_recvmmsg {
+    struct mmsghdr *msgvec;
+    unsigned int vlen;
+    int flags;
+    int result;
+};
+
+static int
+sock_recvmmsg_impl(PySocketSockObject *s, void *data)
+{
+    struct sock_recvmmsg *ctx = data;
+
+    ctx->result = recvmmsg(s->sock_fd, ctx->msgvec, ctx->vlen,
+                           ctx->flags, NULL);
+    return (ctx->result >= 0);
+}
+
+/* s.recvmmsg_into(buffers[, flags]) method */
+
+static PyObject *
+sock_recvmmsg_into(PySocketSockObject *s, PyObject *args)
+{
+    Py_ssize_t i, nitems, nbufs = 0;
+    int flags = 0;
+    socklen_t addrbuflen;
+    PyObject *buffers_arg, *buffers_fast = NULL, *retval = NULL;
+    Py_buffer *bufs = NULL;
+    struct iovec *iovs = NULL;
+    struct mmsghdr *msgvec = NULL;
+    sock_addr_t *addrbufs = NULL;
+    struct sock_recvmmsg ctx;
+
+    if (!PyArg_ParseTuple(args, "O|i:recvmmsg_into", &buffers_arg, &flags))
+        return NULL;
+
+    if (!getsockaddrlen(s, &addrbuflen))
+        return NULL;
+
+    buffers_fast = PySequence_Fast(buffers_arg,
+                                   "recvmmsg_into() argument 1 must be an "
+                                   "iterable");
+    if (buffers_fast == NULL)
+        return NULL;
+    nitems = PySequence_Fast_GET_SIZE(buffers_fast);
+    if (nitems == 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "recvmmsg_into() argument 1 must not be empty");
+        goto finally;
+    }
+    if (nitems > INT_MAX) {
+        PyErr_SetString(PyExc_OSError,
+                        "recvmmsg_into() argument 1 is too long");
+        goto finally;
+    }
+
+    bufs = PyMem_New(Py_buffer, nitems);
+    iovs = PyMem_New(struct iovec, nitems);
+    msgvec = PyMem_New(struct mmsghdr, nitems);
+    addrbufs = PyMem_New(sock_addr_t, nitems);
+    if (bufs == NULL || iovs == NULL || msgvec == NULL || addrbufs == NULL) {
+        PyErr_NoMemory();
+        goto finally;
+    }
+    memset(msgvec, 0, nitems * sizeof(struct mmsghdr));
+
+    /* Each buffer receives a single datagram, see the comment in
+       sock_recvmsg_guts() about initializing the address buffers. */
+    for (; nbufs < nitems; nbufs++) {
+        struct msghdr *msg = &msgvec[nbufs].msg_hdr;
+
+        if (!PyArg_Parse(PySequence_Fast_GET_ITEM(buffers_fast, nbufs),
+                         "w*;recvmmsg_into() argument 1 must be an iterable "
+                         "of single-segment read-write buffers",
+                         &bufs[nbufs]))
+            goto finally;
+        iovs[nbufs].iov_base = bufs[nbufs].buf;
+        iovs[nbufs].iov_len = bufs[nbufs].len;
+        memset(&addrbufs[nbufs], 0, addrbuflen);
+        SAS2SA(&addrbufs[nbufs])->sa_family = AF_UNSPEC;
+        msg->msg_name = SAS2SA(&addrbufs[nbufs]);
+        msg->msg_namelen = addrbuflen;
+        msg->msg_iov = &iovs[nbufs];
+        msg->msg_iovlen = 1;
+    }
+
+    if (!IS_SELECTABLE(s)) {
+        select_error();
+        goto finally;
+    }
+
+    ctx.msgvec = msgvec;
+    ctx.vlen = (unsigned int)nitems;
+    ctx.flags = flags;
+#ifdef MSG_WAITFORONE
+    /* Only block until the first datagram has arrived. */
+    ctx.flags |= MSG_WAITFORONE;
+#endif
+    if (sock_call(s, 0, sock_recvmmsg_impl, &ctx) < 0)
+        goto finally;
+
+    retval = PyList_New(ctx.result);
+    if (retval == NULL)
+        goto finally;
+    for (i = 0; i < ctx.result; i++) {
+        struct msghdr *msg = &msgvec[i].msg_hdr;
+        PyObject *addr, *item;
+
+        addr = makesockaddr(s->sock_fd, SAS2SA(&addrbufs[i]),
+                            msg->msg_namelen, s->sock_proto);
+        if (addr == NULL) {
+            Py_CLEAR(retval);
+            goto finally;
+        }
+        item = Py_BuildValue("(IN)", msgvec[i].msg_len, addr);
+        if (item == NULL) {
+            Py_CLEAR(retval);
+            goto finally;
+        }
+        PyList_SET_ITEM(retval, i, item);
+    }
+
+finally:
+    for (i = 0; i < nbufs; i++)
+        PyBuffer_Release(&bufs[i]);
+    PyMem_Free(addrbufs);
+    PyMem_Free(msgvec);
+    PyMem_Free(iovs);
+    PyMem_Free(bufs);
+    Py_DECREF(buffers_fast);
+    return retval;
+}
+
+PyDoc_STRVAR(recvmmsg_into_doc,
+"recvmmsg_into(buffers[, flags]) -> list of (nbytes, address info)\n\
+\n\
+Receive up to len(buffers) datagrams from the socket with a single\n\
+system call, storing one datagram into each of the given buffers.\n\
+The buffers argument must be a non-empty iterable of objects that\n\
+export writable buffers (e.g. bytearray objects).  The call blocks\n\
+until at least one datagram is available and then returns whatever\n\
+has been queued without waiting further.  The flags argument defaults\n\
+to 0 and has the same meaning as for recv().  The return value is a\n\
+list with one (nbytes, address) tuple for each datagram received, in\n\
+the order of the buffers that were filled.  Datagrams larger than\n\
+their buffer are truncated.");
+#endif    /* HAVE_RECVMMSG */
+
+#ifdef HAVE_SENDMMSG
+struct sock_sendmmsg {
+    struct mmsghdr *msgvec;
+    unsigned int vlen;
+    int flags;
+    int result;
+};
+
+static int
+sock_sendmmsg_impl(PySocketSockObject *s, void *data)
+{
+    struct sock_sendmmsg *ctx = data;
+
+    ctx->result = sendmmsg(s->sock_fd, ctx->msgvec, ctx->vlen, ctx->flags);
+    return (ctx->result >= 0);
+}
+
+/* s.sendmmsg(buffers[, flags[, address]]) method */
+
+static PyObject *
+sock_sendmmsg(PySocketSockObject *s, PyObject *args)
+{
+    Py_ssize_t i, nitems, nbufs = 0;
+    int addrlen, flags = 0;
+    sock_addr_t addrbuf;
+    PyObject *buffers_arg, *addr_arg = NULL, *buffers_fast = NULL;
+    PyObject *retval = NULL;
+    Py_buffer *bufs = NULL;
+    struct iovec *iovs = NULL;
+    struct mmsghdr *msgvec = NULL;
+    struct sock_sendmmsg ctx;
+
+    if (!PyArg_ParseTuple(args, "O|iO:sendmmsg",
+                          &buffers_arg, &flags, &addr_arg)) {
+        return NULL;
+    }
+
+    /* Parse destination address, shared by all datagrams. */
+    if (addr_arg == Py_None) {
+        addr_arg = NULL;
+    }
+    if (addr_arg != NULL &&
+        !getsockaddrarg(s, addr_arg, &addrbuf, &addrlen, "sendmmsg"))
+    {
+        return NULL;
+    }
+    if (PySys_Audit("socket.sendmmsg", "OO", s,
+                    addr_arg != NULL ? addr_arg : Py_None) < 0) {
+        return NULL;
+    }
+
+    buffers_fast = PySequence_Fast(buffers_arg,
+                                   "sendmmsg() argument 1 must be an "
+                                   "iterable");
+    if (buffers_fast == NULL)
+        return NULL;
+    nitems = PySequence_Fast_GET_SIZE(buffers_fast);
+    if (nitems == 0) {
+        retval = PyLong_FromLong(0);
+        goto finally;
+    }
+    if (nitems > INT_MAX) {
+        PyErr_SetString(PyExc_OSError, "sendmmsg() argument 1 is too long");
+        goto finally;
+    }
+
+    bufs = PyMem_New(Py_buffer, nitems);
+    iovs = PyMem_New(struct iovec, nitems);
+    msgvec = PyMem_New(struct mmsghdr, nitems);
+    if (bufs == NULL || iovs == NULL || msgvec == NULL) {
+        PyErr_NoMemory();
+        goto finally;
+    }
+    memset(msgvec, 0, nitems * sizeof(struct mmsghdr));
+
+    /* Each buffer is sent as a single datagram. */
+    for (; nbufs < nitems; nbufs++) {
+        struct msghdr *msg = &msgvec[nbufs].msg_hdr;
+
+        if (!PyArg_Parse(PySequence_Fast_GET_ITEM(buffers_fast, nbufs),
+                         "y*;sendmmsg() argument 1 must be an iterable of "
+                         "bytes-like objects",
+                         &bufs[nbufs]))
+            goto finally;
+        iovs[nbufs].iov_base = bufs[nbufs].buf;
+        iovs[nbufs].iov_len = bufs[nbufs].len;
+        if (addr_arg != NULL) {
+            msg->msg_name = &addrbuf;
+            msg->msg_namelen = addrlen;
+        }
+        msg->msg_iov = &iovs[nbufs];
+        msg->msg_iovlen = 1;
+    }
+
+    if (!IS_SELECTABLE(s)) {
+        select_error();
+        goto finally;
+    }
+
+    ctx.msgvec = msgvec;
+    ctx.vlen = (unsigned int)nitems;
+    ctx.flags = flags;
+    if (sock_call(s, 1, sock_sendmmsg_impl, &ctx) < 0)
+        goto finally;
+
+    retval = PyLong_FromLong(ctx.result);
+
+finally:
+    for (i = 0; i < nbufs; i++)
+        PyBuffer_Release(&bufs[i]);
+    PyMem_Free(msgvec);
+    PyMem_Free(iovs);
+    PyMem_Free(bufs);
+    Py_DECREF(buffers_fast);
+    return retval;
+}
+
+PyDoc_STRVAR(sendmmsg_doc,
+"sendmmsg(buffers[, flags[, address]]) -> count\n\
+\n\
+Send each of the given buffers as a separate datagram with a single\n\
+system call.  The buffers argument specifies the data as an iterable\n\
+of bytes-like objects (e.g. bytes objects).  The flags argument\n\
+defaults to 0 and has the same meaning as for send().  If address is\n\
+supplied and not None, it sets the destination address for all the\n\
+datagrams.  The return value is the number of datagrams sent, which\n\
+may be less than len(buffers).");
+#endif    /* HAVE_SENDMMSG */
+
 #ifdef HAVE_SOCKADDR_ALG
 static PyObject*
 sock_sendmsg_afalg(PySocketSockObject *self, PyObject *args, PyObject *kwds)
@@ -5230,6 +5507,14 @@ static PyMethodDef sock_methods[] = {
     {"sendmsg",           (PyCFunction)sock_sendmsg, METH_VARARGS,
                       sendmsg_doc},
 #endif
+#ifdef HAVE_RECVMMSG
+    {"recvmmsg_into",     (PyCFunction)sock_recvmmsg_into, METH_VARARGS,
+                      recvmmsg_into_doc},
+#endif
+#ifdef HAVE_SENDMMSG
+    {"sendmmsg",          (PyCFunction)sock_sendmmsg, METH_VARARGS,
+                      sendmmsg_doc},
+#endif
 #ifdef HAVE_SOCKADDR_ALG
     {"sendmsg_afalg",     _PyCFunction_CAST(sock_sendmsg_afalg), METH_VARARGS | METH_KEYWORDS,
                       sendmsg_afalg_doc},
@@ -7977,6 +8262,9 @@ socket_exec(PyObject *m)
 #ifdef  SO_BINDTOIFINDEX
     ADD_INT_MACRO(m, SO_BINDTOIFINDEX);
 #endif
+#ifdef  SO_ZEROCOPY
+    ADD_INT_MACRO(m, SO_ZEROCOPY);
+#endif
 #ifdef  SO_PRIORITY
     ADD_INT_MACRO(m, SO_PRIORITY);
 #endif
@@ -8088,6 +8376,9 @@ socket_exec(PyObject *m)
 #ifdef MSG_FASTOPEN
     ADD_INT_MACRO(m, MSG_FASTOPEN);
 #endif
+#ifdef  MSG_ZEROCOPY
+    ADD_INT_MACRO(m, MSG_ZEROCOPY);
+#endif
 
     /* Protocol level and numbers, usable for [gs]etsockopt */
 #ifdef  SOL_SOCKET
@@ -8735,6 +9026,14 @@ socket_exec(PyObject *m)
     ADD_INT_MACRO(m, TCP_TX_DELAY);
 #endif
 
+    /* UDP options */
+#ifdef  UDP_SEGMENT
+    ADD_INT_MACRO(m, UDP_SEGMENT);
+#endif
+#ifdef  UDP_GRO
+    ADD_INT_MACRO(m, UDP_GRO);
+#endif
+
     /* IPX options */
 #ifdef  IPX_TYPE
     ADD_INT_MACRO(m, IPX_TYPE);
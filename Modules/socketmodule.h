@@ -9,6 +9,9 @@
 # endif
 # include <netinet/in.h>
 # include <netinet/tcp.h>
+# ifdef HAVE_NETINET_UDP_H
+#   include <netinet/udp.h>
+# endif
 
 #else /* MS_WINDOWS */
 # include <winsock2.h>
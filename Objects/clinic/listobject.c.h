@@ -182,7 +182,7 @@ exit:
 }
 
 PyDoc_STRVAR(list_sort__doc__,
-"sort($self, /, *, key=None, reverse=False)\n"
+"sort($self, /, *, key=None, reverse=False, parallel=0)\n"
 "--\n"
 "\n"
 "Sort the list in ascending order and return None.\n"
@@ -193,13 +193,17 @@ PyDoc_STRVAR(list_sort__doc__,
 "If a key function is given, apply it once to each list item and sort them,\n"
 "ascending or descending, according to their function values.\n"
 "\n"
-"The reverse flag can be set to sort in descending order.");
+"The reverse flag can be set to sort in descending order.\n"
+"\n"
+"If parallel is greater than 1, a large list may be sorted using up to that\n"
+"many threads.  This only has an effect in the free-threaded build.");
 
 #define LIST_SORT_METHODDEF    \
     {"sort", _PyCFunction_CAST(list_sort), METH_FASTCALL|METH_KEYWORDS, list_sort__doc__},
 
 static PyObject *
-list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse);
+list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse,
+               Py_ssize_t parallel);
 
 static PyObject *
 list_sort(PyListObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
@@ -207,14 +211,14 @@ list_sort(PyListObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject
     PyObject *return_value = NULL;
     #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
 
-    #define NUM_KEYWORDS 2
+    #define NUM_KEYWORDS 3
     static struct {
         PyGC_Head _this_is_not_used;
         PyObject_VAR_HEAD
         PyObject *ob_item[NUM_KEYWORDS];
     } _kwtuple = {
         .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
-        .ob_item = { &_Py_ID(key), &_Py_ID(reverse), },
+        .ob_item = { &_Py_ID(key), &_Py_ID(reverse), &_Py_ID(parallel), },
     };
     #undef NUM_KEYWORDS
     #define KWTUPLE (&_kwtuple.ob_base.ob_base)
@@ -223,17 +227,18 @@ list_sort(PyListObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject
     #  define KWTUPLE NULL
     #endif  // !Py_BUILD_CORE
 
-    static const char * const _keywords[] = {"key", "reverse", NULL};
+    static const char * const _keywords[] = {"key", "reverse", "parallel", NULL};
     static _PyArg_Parser _parser = {
         .keywords = _keywords,
         .fname = "sort",
         .kwtuple = KWTUPLE,
     };
     #undef KWTUPLE
-    PyObject *argsbuf[2];
+    PyObject *argsbuf[3];
     Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 0;
     PyObject *keyfunc = Py_None;
     int reverse = 0;
+    Py_ssize_t parallel = 0;
 
     args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 0, 0, 0, argsbuf);
     if (!args) {
@@ -248,13 +253,30 @@ list_sort(PyListObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject
             goto skip_optional_kwonly;
         }
     }
-    reverse = PyObject_IsTrue(args[1]);
-    if (reverse < 0) {
-        goto exit;
+    if (args[1]) {
+        reverse = PyObject_IsTrue(args[1]);
+        if (reverse < 0) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_kwonly;
+        }
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[2]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        parallel = ival;
     }
 skip_optional_kwonly:
     Py_BEGIN_CRITICAL_SECTION(self);
-    return_value = list_sort_impl(self, keyfunc, reverse);
+    return_value = list_sort_impl(self, keyfunc, reverse, parallel);
     Py_END_CRITICAL_SECTION();
 
 exit:
@@ -439,4 +461,4 @@ list___reversed__(PyListObject *self, PyObject *Py_UNUSED(ignored))
 {
     return list___reversed___impl(self);
 }
-/*[clinic end generated code: output=854957a1d4a89bbd input=a9049054013a1b77]*/
+/*[clinic end generated code: output=6372b4c0371cc029 input=a9049054013a1b77]*/
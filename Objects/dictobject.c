@@ -1247,6 +1247,30 @@ _Py_dict_lookup(PyDictObject *mp, PyObject *key, Py_hash_t hash, PyObject **valu
 }
 
 #ifdef Py_GIL_DISABLED
+// Allow other threads to take references to the key of entry ix of a
+// combined table without locking the dict.  An object that has never been
+// shared can't be incref'd by a non-owning thread (see _Py_TryIncRefShared()),
+// so the lock-free lookup of such an entry fails and is retried under the
+// dict's lock, where _Py_NewRefWithLock() marks the value.  Marking the key
+// as well lets every later read of the entry from any thread skip the lock,
+// without walking the whole table at once.
+static void
+set_key_maybe_weakref(PyDictObject *mp, Py_ssize_t ix)
+{
+    ASSERT_DICT_LOCKED(mp);
+    PyDictKeysObject *dk = mp->ma_keys;
+
+    if (_PyDict_HasSplitTable(mp)) {
+        return;
+    }
+    if (DK_IS_UNICODE(dk)) {
+        _PyObject_SetMaybeWeakref(DK_UNICODE_ENTRIES(dk)[ix].me_key);
+    }
+    else {
+        _PyObject_SetMaybeWeakref(DK_ENTRIES(dk)[ix].me_key);
+    }
+}
+
 static inline void
 ensure_shared_on_read(PyDictObject *mp)
 {
@@ -1493,6 +1517,7 @@ _Py_dict_lookup_threadsafe(PyDictObject *mp, PyObject *key, Py_hash_t hash, PyOb
     if (value != NULL) {
         assert(ix >= 0);
         _Py_NewRefWithLock(value);
+        set_key_maybe_weakref(mp, ix);
     }
     Py_END_CRITICAL_SECTION();
     return ix;
@@ -2105,6 +2130,35 @@ dictresize(PyInterpreterState *interp, PyDictObject *mp,
     return 0;
 }
 
+/* Grow mp, which has just received its first items, so that about n items
+ * fit without further resizing.  The current keys kind is kept.  Since n
+ * usually comes from a length hint, the table is capped at the same medium
+ * size as in dict_new_presized() below.
+ */
+static int
+dict_presize_lock_held(PyInterpreterState *interp, PyDictObject *mp,
+                       Py_ssize_t n)
+{
+    const uint8_t log2_max_presize = 17;
+    const Py_ssize_t max_presize = ((Py_ssize_t)1) << log2_max_presize;
+    uint8_t log2_newsize;
+
+    ASSERT_DICT_LOCKED(mp);
+    if (mp->ma_values != NULL || n <= USABLE_FRACTION(DK_SIZE(mp->ma_keys))) {
+        return 0;
+    }
+    if (n > USABLE_FRACTION(max_presize)) {
+        log2_newsize = log2_max_presize;
+    }
+    else {
+        log2_newsize = estimate_log2_keysize(n);
+    }
+    if (log2_newsize <= DK_LOG_SIZE(mp->ma_keys)) {
+        return 0;
+    }
+    return dictresize(interp, mp, log2_newsize, DK_IS_UNICODE(mp->ma_keys));
+}
+
 static PyObject *
 dict_new_presized(PyInterpreterState *interp, Py_ssize_t minused, bool unicode)
 {
@@ -3172,6 +3226,10 @@ _PyDict_FromKeys(PyObject *cls, PyObject *iterable, PyObject *value)
     }
 
     if (PyDict_CheckExact(d)) {
+        Py_ssize_t hint = PyObject_LengthHint(iterable, 0);
+        if (hint < 0) {
+            goto Fail;
+        }
         Py_BEGIN_CRITICAL_SECTION(d);
         while ((key = PyIter_Next(it)) != NULL) {
             status = setitem_lock_held((PyDictObject *)d, key, value);
@@ -3180,6 +3238,15 @@ _PyDict_FromKeys(PyObject *cls, PyObject *iterable, PyObject *value)
                 assert(PyErr_Occurred());
                 goto dict_iter_exit;
             }
+            /* Presize once the kind of the keys is known. */
+            if (hint > 1) {
+                status = dict_presize_lock_held(interp, (PyDictObject *)d,
+                                                hint);
+                if (status < 0) {
+                    goto dict_iter_exit;
+                }
+                hint = 0;
+            }
         }
 dict_iter_exit:;
         Py_END_CRITICAL_SECTION();
@@ -3651,6 +3718,16 @@ merge_from_seq2_lock_held(PyObject *d, PyObject *seq2, int override)
     assert(PyDict_Check(d));
     assert(seq2 != NULL);
 
+    /* Presize an empty dict once the kind of its keys is known, that is
+     * after the first item has been inserted. */
+    Py_ssize_t hint = 0;
+    if (PyDict_CheckExact(d) && ((PyDictObject *)d)->ma_used == 0) {
+        hint = PyObject_LengthHint(seq2, 0);
+        if (hint < 0) {
+            return -1;
+        }
+    }
+
     it = PyObject_GetIter(seq2);
     if (it == NULL)
         return -1;
@@ -3710,6 +3787,13 @@ merge_from_seq2_lock_held(PyObject *d, PyObject *seq2, int override)
         Py_DECREF(value);
         Py_DECREF(fast);
         Py_DECREF(item);
+
+        if (i == 0 && hint > 1 &&
+            dict_presize_lock_held(_PyInterpreterState_GET(),
+                                   (PyDictObject *)d, hint) < 0) {
+            item = fast = NULL;
+            goto Fail;
+        }
     }
 
     i = 0;
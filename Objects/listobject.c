@@ -11,6 +11,7 @@
 #include "pycore_long.h"          // _PyLong_DigitCount
 #include "pycore_modsupport.h"    // _PyArg_NoKwnames()
 #include "pycore_object.h"        // _PyObject_GC_TRACK(), _PyDebugAllocatorStats()
+#include "pycore_pythread.h"      // PyThread_start_joinable_thread()
 #include "pycore_tuple.h"         // _PyTuple_FromArray()
 #include "pycore_setobject.h"     // _PySet_NextEntry()
 #include <stddef.h>
@@ -2784,6 +2785,313 @@ unsafe_tuple_compare(PyObject *v, PyObject *w, MergeState *ms)
         return PyObject_RichCompareBool(vt->ob_item[i], wt->ob_item[i], Py_LT);
 }
 
+/* Sort the n elements starting at lo, which must be the slice ms was
+ * initialized with.  On success ms holds exactly one pending run covering
+ * the whole slice.  Returns 0 on success, -1 on error.
+ */
+static int
+sort_slice(MergeState *ms, sortslice lo, Py_ssize_t nremaining)
+{
+    Py_ssize_t minrun;
+
+    /* March over the array once, left to right, finding natural runs,
+     * and extending short natural runs to minrun elements.
+     */
+    minrun = merge_compute_minrun(nremaining);
+    do {
+        Py_ssize_t n;
+
+        /* Identify next run. */
+        n = count_run(ms, &lo, nremaining);
+        if (n < 0)
+            return -1;
+        /* If short, extend to min(minrun, nremaining). */
+        if (n < minrun) {
+            const Py_ssize_t force = nremaining <= minrun ?
+                              nremaining : minrun;
+            if (binarysort(ms, &lo, force, n) < 0)
+                return -1;
+            n = force;
+        }
+        /* Maybe merge pending runs. */
+        assert(ms->n == 0 || ms->pending[ms->n -1].base.keys +
+                             ms->pending[ms->n-1].len == lo.keys);
+        if (found_new_run(ms, n) < 0)
+            return -1;
+        /* Push new run on stack. */
+        assert(ms->n < MAX_MERGE_PENDING);
+        ms->pending[ms->n].base = lo;
+        ms->pending[ms->n].len = n;
+        ++ms->n;
+        /* Advance to find next run. */
+        sortslice_advance(&lo, n);
+        nremaining -= n;
+    } while (nremaining);
+
+    return merge_force_collapse(ms);
+}
+
+#ifdef Py_GIL_DISABLED
+/* Parallel sorting for the free-threaded build.
+ *
+ * When list.sort() is called with parallel > 1, the list is large enough,
+ * and every comparison is known to be free of side effects, the slice is
+ * cut into contiguous chunks that are sorted concurrently, each by its own
+ * MergeState on its own thread.  Adjacent sorted chunks are then merged
+ * pairwise, again concurrently, until a single run remains.  Since only
+ * adjacent runs are ever merged, and merge_at() is stable, the result is
+ * exactly what the sequential sort produces.
+ *
+ * The calling thread always performs one of the tasks of each round itself.
+ * If a worker thread can't be started, or can't get a thread state, its
+ * task is performed by the calling thread after the others are joined.
+ */
+
+/* Minimum number of elements handed to one thread.  Worker threads are
+ * started and joined by every call, which costs about half a millisecond
+ * per thread; sorting a chunk of this size takes several milliseconds, so
+ * the start-up cost stays a small fraction of the work that is moved off
+ * the calling thread.  Smaller lists are always sorted sequentially.
+ */
+#define PARALLEL_SORT_MIN_CHUNK (1 << 15)
+
+/* Maximum length of tuple keys for which a parallel sort is attempted. */
+#define PARALLEL_SORT_MAX_TUPLE 16
+
+typedef struct {
+    MergeState ms;
+    sortslice lo;
+    Py_ssize_t na;      /* length of the slice to sort, or of the left run */
+    Py_ssize_t nb;      /* length of the right run; 0 when sorting */
+    PyInterpreterState *interp;
+    PyThread_handle_t handle;
+    int started;
+    int result;         /* 0 on success, -1 on error, 1 if not run yet */
+    PyObject *exc;      /* exception raised by a worker thread, or NULL */
+} sort_task;
+
+/* Return 1 if comparing the keys can neither run Python code nor fail. */
+static int
+parallel_sort_is_safe(MergeState *ms, sortslice *lo, Py_ssize_t n)
+{
+    if (ms->key_compare == unsafe_latin_compare ||
+        ms->key_compare == unsafe_long_compare ||
+        ms->key_compare == unsafe_float_compare)
+    {
+        return 1;
+    }
+    if (ms->key_compare != unsafe_tuple_compare ||
+        !(ms->tuple_elem_compare == unsafe_latin_compare ||
+          ms->tuple_elem_compare == unsafe_long_compare ||
+          ms->tuple_elem_compare == unsafe_float_compare))
+    {
+        return 0;
+    }
+    /* unsafe_tuple_compare() falls back to PyObject_RichCompareBool() for
+     * the remaining items, so they must all be of immutable builtin types
+     * whose comparisons are side-effect free and can't fail.  Items at the
+     * same position may thus be compared to each other, so they must all be
+     * of the same type, except that ints and floats can be mixed.
+     */
+    char kinds[PARALLEL_SORT_MAX_TUPLE];
+    Py_ssize_t nkinds = 0;
+    for (Py_ssize_t i = 0; i < n; i++) {
+        PyObject *key = lo->keys[i];
+        if (Py_SIZE(key) > PARALLEL_SORT_MAX_TUPLE) {
+            return 0;
+        }
+        for (Py_ssize_t j = 1; j < Py_SIZE(key); j++) {
+            PyObject *item = PyTuple_GET_ITEM(key, j);
+            char kind;
+            if (PyLong_CheckExact(item) || PyFloat_CheckExact(item)) {
+                kind = 'n';
+            }
+            else if (PyUnicode_CheckExact(item)) {
+                kind = 's';
+            }
+            else if (PyBytes_CheckExact(item)) {
+                kind = 'b';
+            }
+            else {
+                return 0;
+            }
+            if (j >= nkinds) {
+                kinds[j] = kind;
+                nkinds = j + 1;
+            }
+            else if (kinds[j] != kind) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+static void
+sort_task_init(sort_task *task, MergeState *ms, sortslice lo,
+               Py_ssize_t na, Py_ssize_t nb, int has_keyfunc)
+{
+    task->lo = lo;
+    task->na = na;
+    task->nb = nb;
+    merge_init(&task->ms, na + nb, has_keyfunc, &task->lo);
+    task->ms.key_compare = ms->key_compare;
+    task->ms.key_richcompare = ms->key_richcompare;
+    task->ms.tuple_elem_compare = ms->tuple_elem_compare;
+    task->interp = _PyInterpreterState_GET();
+    task->started = 0;
+    task->result = 1;
+    task->exc = NULL;
+}
+
+static void
+sort_task_run(sort_task *task)
+{
+    MergeState *ms = &task->ms;
+
+    if (task->nb == 0) {
+        task->result = sort_slice(ms, task->lo, task->na);
+    }
+    else {
+        ms->pending[0].base = task->lo;
+        ms->pending[0].len = task->na;
+        ms->pending[1].base = task->lo;
+        sortslice_advance(&ms->pending[1].base, task->na);
+        ms->pending[1].len = task->nb;
+        ms->n = 2;
+        task->result = merge_at(ms, 0) < 0 ? -1 : 0;
+    }
+    merge_freemem(ms);
+}
+
+static void
+sort_task_worker(void *arg)
+{
+    sort_task *task = (sort_task *)arg;
+    PyThreadState *tstate = PyThreadState_New(task->interp);
+    if (tstate == NULL) {
+        /* Leave the task to the calling thread. */
+        return;
+    }
+    PyEval_RestoreThread(tstate);
+    sort_task_run(task);
+    if (task->result < 0) {
+        /* Hand the exception over to the calling thread. */
+        task->exc = PyErr_GetRaisedException();
+    }
+    PyThreadState_Clear(tstate);
+    PyThreadState_DeleteCurrent();
+}
+
+/* Run tasks[0:ntasks] concurrently.  Returns 0 on success, -1 on error. */
+static int
+sort_tasks_run(sort_task *tasks, Py_ssize_t ntasks)
+{
+    int result = 0;
+
+    for (Py_ssize_t i = 1; i < ntasks; i++) {
+        PyThread_ident_t ident;
+        tasks[i].started = PyThread_start_joinable_thread(
+            sort_task_worker, &tasks[i], &ident, &tasks[i].handle) == 0;
+    }
+    sort_task_run(&tasks[0]);
+
+    Py_BEGIN_ALLOW_THREADS
+    for (Py_ssize_t i = 1; i < ntasks; i++) {
+        if (tasks[i].started) {
+            PyThread_join_thread(tasks[i].handle);
+        }
+    }
+    Py_END_ALLOW_THREADS
+
+    for (Py_ssize_t i = 0; i < ntasks; i++) {
+        if (tasks[i].result == 1 && result == 0) {
+            sort_task_run(&tasks[i]);
+        }
+        if (tasks[i].result < 0) {
+            if (result == 0 && tasks[i].exc != NULL) {
+                assert(!PyErr_Occurred());
+                PyErr_SetRaisedException(tasks[i].exc);
+                tasks[i].exc = NULL;
+            }
+            result = -1;
+        }
+        Py_CLEAR(tasks[i].exc);
+    }
+    if (result < 0 && !PyErr_Occurred()) {
+        PyErr_NoMemory();
+    }
+    return result;
+}
+
+/* Sort the n elements starting at lo using at most nthreads threads.
+ * Returns 0 on success, -1 on error.
+ */
+static int
+parallel_sort_slice(MergeState *ms, sortslice *lo, Py_ssize_t n,
+                    int has_keyfunc, Py_ssize_t nthreads)
+{
+    Py_ssize_t nruns = Py_MIN(nthreads, n / PARALLEL_SORT_MIN_CHUNK);
+    sort_task *tasks;
+    Py_ssize_t *bounds;
+    int result = -1;
+
+    assert(nruns >= 2);
+    tasks = PyMem_New(sort_task, nruns);
+    bounds = PyMem_New(Py_ssize_t, nruns + 1);
+    if (tasks == NULL || bounds == NULL) {
+        PyErr_NoMemory();
+        goto done;
+    }
+
+    /* Sort nruns chunks of (nearly) equal size. */
+    for (Py_ssize_t i = 0; i <= nruns; i++) {
+        bounds[i] = n / nruns * i + Py_MIN(i, n % nruns);
+    }
+    for (Py_ssize_t i = 0; i < nruns; i++) {
+        sortslice s = *lo;
+        sortslice_advance(&s, bounds[i]);
+        sort_task_init(&tasks[i], ms, s, bounds[i + 1] - bounds[i], 0,
+                       has_keyfunc);
+    }
+    if (sort_tasks_run(tasks, nruns) < 0) {
+        goto done;
+    }
+
+    /* Merge adjacent runs pairwise until one is left.  With an odd number
+     * of runs, the last one is carried over to the next round as is.
+     */
+    while (nruns > 1) {
+        Py_ssize_t ntasks = nruns / 2;
+        for (Py_ssize_t i = 0; i < ntasks; i++) {
+            sortslice s = *lo;
+            Py_ssize_t start = bounds[2 * i];
+            sortslice_advance(&s, start);
+            sort_task_init(&tasks[i], ms, s, bounds[2 * i + 1] - start,
+                           bounds[2 * i + 2] - bounds[2 * i + 1],
+                           has_keyfunc);
+        }
+        if (sort_tasks_run(tasks, ntasks) < 0) {
+            goto done;
+        }
+        for (Py_ssize_t i = 1; i <= ntasks; i++) {
+            bounds[i] = bounds[2 * i];
+        }
+        if (nruns & 1) {
+            bounds[ntasks + 1] = bounds[nruns];
+            ntasks++;
+        }
+        nruns = ntasks;
+    }
+    result = 0;
+
+done:
+    PyMem_Free(tasks);
+    PyMem_Free(bounds);
+    return result;
+}
+#endif  /* Py_GIL_DISABLED */
+
 /* An adaptive, stable, natural mergesort.  See listsort.txt.
  * Returns Py_None on success, NULL on error.  Even in case of error, the
  * list will be some permutation of its input state (nothing is lost or
@@ -2796,6 +3104,7 @@ list.sort
     *
     key as keyfunc: object = None
     reverse: bool = False
+    parallel: Py_ssize_t = 0
 
 Sort the list in ascending order and return None.
 
@@ -2806,15 +3115,18 @@ If a key function is given, apply it once to each list item and sort them,
 ascending or descending, according to their function values.
 
 The reverse flag can be set to sort in descending order.
+
+If parallel is greater than 1, a large list may be sorted using up to that
+many threads.  This only has an effect in the free-threaded build.
 [clinic start generated code]*/
 
 static PyObject *
-list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
-/*[clinic end generated code: output=57b9f9c5e23fbe42 input=667bf25d0e3a3676]*/
+list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse,
+               Py_ssize_t parallel)
+/*[clinic end generated code: output=f68f37becc92bfe1 input=2e6fff104ad6320f]*/
 {
     MergeState ms;
     Py_ssize_t nremaining;
-    Py_ssize_t minrun;
     sortslice lo;
     Py_ssize_t saved_ob_size, saved_allocated;
     PyObject **saved_ob_item;
@@ -2984,41 +3296,18 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
         reverse_slice(&saved_ob_item[0], &saved_ob_item[saved_ob_size]);
     }
 
-    /* March over the array once, left to right, finding natural runs,
-     * and extending short natural runs to minrun elements.
-     */
-    minrun = merge_compute_minrun(nremaining);
-    do {
-        Py_ssize_t n;
-
-        /* Identify next run. */
-        n = count_run(&ms, &lo, nremaining);
-        if (n < 0)
-            goto fail;
-        /* If short, extend to min(minrun, nremaining). */
-        if (n < minrun) {
-            const Py_ssize_t force = nremaining <= minrun ?
-                              nremaining : minrun;
-            if (binarysort(&ms, &lo, force, n) < 0)
-                goto fail;
-            n = force;
-        }
-        /* Maybe merge pending runs. */
-        assert(ms.n == 0 || ms.pending[ms.n -1].base.keys +
-                            ms.pending[ms.n-1].len == lo.keys);
-        if (found_new_run(&ms, n) < 0)
+#ifdef Py_GIL_DISABLED
+    if (parallel > 1 && nremaining >= 2 * PARALLEL_SORT_MIN_CHUNK &&
+        !Py_IsFinalizing() && parallel_sort_is_safe(&ms, &lo, nremaining))
+    {
+        if (parallel_sort_slice(&ms, &lo, nremaining, keys != NULL,
+                                parallel) < 0)
             goto fail;
-        /* Push new run on stack. */
-        assert(ms.n < MAX_MERGE_PENDING);
-        ms.pending[ms.n].base = lo;
-        ms.pending[ms.n].len = n;
-        ++ms.n;
-        /* Advance to find next run. */
-        sortslice_advance(&lo, n);
-        nremaining -= n;
-    } while (nremaining);
+        goto succeed;
+    }
+#endif
 
-    if (merge_force_collapse(&ms) < 0)
+    if (sort_slice(&ms, lo, nremaining) < 0)
         goto fail;
     assert(ms.n == 1);
     assert(keys == NULL
@@ -3082,7 +3371,7 @@ PyList_Sort(PyObject *v)
         return -1;
     }
     Py_BEGIN_CRITICAL_SECTION(v);
-    v = list_sort_impl((PyListObject *)v, NULL, 0);
+    v = list_sort_impl((PyListObject *)v, NULL, 0, 0);
     Py_END_CRITICAL_SECTION();
     if (v == NULL)
         return -1;
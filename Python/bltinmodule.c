@@ -3068,6 +3068,31 @@ zip_reduce(zipobject *lz, PyObject *Py_UNUSED(ignored))
     return PyTuple_Pack(2, Py_TYPE(lz), lz->ittuple);
 }
 
+static PyObject *
+zip_length_hint(zipobject *lz, PyObject *Py_UNUSED(ignored))
+{
+    /* zip() stops with its shortest argument, so the smallest hint is used.
+       If any iterator gives no hint, the result can be arbitrarily shorter
+       than the others, and no estimate is made. */
+    Py_ssize_t tuplesize = lz->tuplesize;
+    Py_ssize_t result = tuplesize ? PY_SSIZE_T_MAX : 0;
+    for (Py_ssize_t i = 0; i < tuplesize; i++) {
+        PyObject *it = PyTuple_GET_ITEM(lz->ittuple, i);
+        Py_ssize_t n = PyObject_LengthHint(it, -2);
+        if (n == -1) {
+            return NULL;
+        }
+        if (n == -2) {
+            Py_RETURN_NOTIMPLEMENTED;
+        }
+        result = Py_MIN(result, n);
+    }
+    return PyLong_FromSsize_t(result);
+}
+
+PyDoc_STRVAR(length_hint_doc,
+             "Private method returning an estimate of len(list(it)).");
+
 PyDoc_STRVAR(setstate_doc, "Set state information for unpickling.");
 
 static PyObject *
@@ -3082,6 +3107,8 @@ zip_setstate(zipobject *lz, PyObject *state)
 }
 
 static PyMethodDef zip_methods[] = {
+    {"__length_hint__", _PyCFunction_CAST(zip_length_hint), METH_NOARGS,
+     length_hint_doc},
     {"__reduce__", _PyCFunction_CAST(zip_reduce), METH_NOARGS, reduce_doc},
     {"__setstate__", _PyCFunction_CAST(zip_setstate), METH_O, setstate_doc},
     {NULL}  /* sentinel */
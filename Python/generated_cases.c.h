@@ -43,12 +43,40 @@
             {
                 PyObject *lhs_o = PyStackRef_AsPyObjectBorrow(lhs);
                 PyObject *rhs_o = PyStackRef_AsPyObjectBorrow(rhs);
+                PyObject *res_o;
+                _PyStackRef *target_local = NULL;
                 assert(_PyEval_BinaryOps[oparg]);
-                _PyFrame_SetStackPointer(frame, stack_pointer);
-                PyObject *res_o = _PyEval_BinaryOps[oparg](lhs_o, rhs_o);
-                stack_pointer = _PyFrame_GetStackPointer(frame);
-                PyStackRef_CLOSE(lhs);
-                PyStackRef_CLOSE(rhs);
+                #if TIER_ONE
+                if (next_instr->op.code == STORE_FAST) {
+                    /* Not GETLOCAL(), which would flag oparg as a local index. */
+                    target_local = &frame->localsplus[next_instr->op.arg];
+                }
+                #endif
+                /* Handle `left = left + right` or `left += right` for a str
+                 * local, like BINARY_OP_INPLACE_ADD_UNICODE does.  This matters
+                 * where that specialization isn't available, such as in the
+                 * free-threaded build: the local's reference is taken over and
+                 * cleared before the STORE_FAST, so that PyUnicode_Append can
+                 * extend the string in place instead of copying it every time.
+                 */
+                if (target_local != NULL &&
+                    (oparg == NB_ADD || oparg == NB_INPLACE_ADD) &&
+                    PyUnicode_CheckExact(lhs_o) && PyUnicode_CheckExact(rhs_o) &&
+                    PyStackRef_Is(*target_local, lhs))
+                {
+                    PyStackRef_CLOSE(lhs);
+                    res_o = PyStackRef_AsPyObjectSteal(*target_local);
+                    *target_local = PyStackRef_NULL;
+                    PyUnicode_Append(&res_o, rhs_o);
+                    PyStackRef_CLOSE(rhs);
+                }
+                else {
+                    _PyFrame_SetStackPointer(frame, stack_pointer);
+                    res_o = _PyEval_BinaryOps[oparg](lhs_o, rhs_o);
+                    stack_pointer = _PyFrame_GetStackPointer(frame);
+                    PyStackRef_CLOSE(lhs);
+                    PyStackRef_CLOSE(rhs);
+                }
                 if (res_o == NULL) goto pop_2_error;
                 res = PyStackRef_FromPyObjectSteal(res_o);
             }